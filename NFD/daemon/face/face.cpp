@@ -55,6 +55,24 @@ Face::isUp() const
   return true;
 }
 
+double
+Face::getInRate() const
+{
+  return 0.0;
+}
+
+double
+Face::getOutRate() const
+{
+  return 0.0;
+}
+
+size_t
+Face::getQueueLength() const
+{
+  return 0;
+}
+
 bool
 Face::decodeAndDispatchInput(const Block& element)
 {
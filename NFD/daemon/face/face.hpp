@@ -154,6 +154,28 @@ public: // attributes
   const FaceCounters&
   getCounters() const;
 
+  /** \brief Get estimated rate of incoming traffic, in bytes per second
+   *
+   *  The estimate reflects recent load of the face and is intended for forwarding strategies.
+   *  In this base class the rate is not estimated and this is always 0.
+   */
+  virtual double
+  getInRate() const;
+
+  /** \brief Get estimated rate of outgoing traffic, in bytes per second
+   *
+   *  In this base class the rate is not estimated and this is always 0.
+   */
+  virtual double
+  getOutRate() const;
+
+  /** \brief Get number of packets waiting for transmission on the underlying link
+   *
+   *  In this base class this is always 0.
+   */
+  virtual size_t
+  getQueueLength() const;
+
   /** \return a FaceUri that represents the remote endpoint
    */
   const FaceUri&
@@ -94,8 +94,10 @@ PartialMessage::reassembleSingle(const NdnlpData& fragment)
   }
 }
 
-PartialMessageStore::PartialMessageStore(const time::nanoseconds& idleDuration)
+PartialMessageStore::PartialMessageStore(const time::nanoseconds& idleDuration,
+                                         size_t maxPartialMessages)
   : m_idleDuration(idleDuration)
+  , m_maxPartialMessages(maxPartialMessages)
 {
 }
 
@@ -110,6 +112,12 @@ PartialMessageStore::receive(const NdnlpData& pkt)
   }
   else {
     uint64_t messageIdentifier = pkt.seq - pkt.fragIndex;
+    if (m_partialMessages.size() >= m_maxPartialMessages &&
+        m_partialMessages.count(messageIdentifier) == 0) {
+      NFD_LOG_TRACE(pkt.seq << " drop, too many partial messages");
+      return;
+    }
+
     PartialMessage& pm = m_partialMessages[messageIdentifier];
     this->scheduleCleanup(messageIdentifier, pm);
 
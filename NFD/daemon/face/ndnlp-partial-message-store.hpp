@@ -29,6 +29,8 @@
 #include "ndnlp-data.hpp"
 #include "core/scheduler.hpp"
 
+#include <limits>
+
 namespace nfd {
 namespace ndnlp {
 
@@ -84,8 +86,13 @@ private:
 class PartialMessageStore : noncopyable
 {
 public:
+  /** \param idleDuration time after the last received fragment when a partial message is dropped
+   *  \param maxPartialMessages maximum number of partial messages; fragments of new messages
+   *         are dropped while the limit is reached
+   */
   explicit
-  PartialMessageStore(const time::nanoseconds& idleDuration = time::milliseconds(100));
+  PartialMessageStore(const time::nanoseconds& idleDuration = time::milliseconds(100),
+                      size_t maxPartialMessages = std::numeric_limits<size_t>::max());
 
   /** \brief receive a NdnlpData packet
    *
@@ -98,6 +105,14 @@ public:
    */
   signal::Signal<PartialMessageStore, Block> onReceive;
 
+  /** \return number of partial messages
+   */
+  size_t
+  size() const
+  {
+    return m_partialMessages.size();
+  }
+
 private:
   void
   scheduleCleanup(uint64_t messageIdentifier, PartialMessage& partialMessage);
@@ -109,6 +124,7 @@ private:
   std::unordered_map<uint64_t, PartialMessage> m_partialMessages;
 
   time::nanoseconds m_idleDuration;
+  size_t m_maxPartialMessages;
 };
 
 } // namespace ndnlp
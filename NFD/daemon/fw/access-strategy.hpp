@@ -167,7 +167,6 @@ public:
 
 private:
   FaceInfoTable m_fit;
-  RetxSuppressionFixed m_retxSuppression;
   signal::ScopedConnection m_removeFaceInfoConn;
 };
 
@@ -53,9 +53,6 @@ public:
 
 public:
   static const Name STRATEGY_NAME;
-
-private:
-  RetxSuppressionExponential m_retxSuppression;
 };
 
 } // namespace fw
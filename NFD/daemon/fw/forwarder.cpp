@@ -584,7 +584,8 @@ void Forwarder::onOutgoingData( const Data &data, Face &outFace ) {
     return;
   }
 
-  // TODO traffic manager
+  // Data are not shaped here: their rate is limited hop-by-hop by Interest shaping on the faces
+  // Interests were forwarded to (see ns3::ndn::NetDeviceFace::setInterestShapingRate)
 
   // send Data
   outFace.sendData( data );
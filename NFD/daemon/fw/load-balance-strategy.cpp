@@ -0,0 +1,114 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "load-balance-strategy.hpp"
+#include "nexthop-selection.hpp"
+#include "core/logger.hpp"
+
+namespace nfd {
+namespace fw {
+
+NFD_LOG_INIT("LoadBalanceStrategy");
+
+const Name LoadBalanceStrategy::STRATEGY_NAME("ndn:/localhost/nfd/strategy/load-balance/%FD%01");
+NFD_REGISTER_STRATEGY(LoadBalanceStrategy);
+
+LoadBalanceStrategy::LoadBalanceStrategy(Forwarder& forwarder, const Name& name)
+  : Strategy(forwarder, name)
+{
+}
+
+bool
+LoadBalanceStrategy::isLessLoaded(const fib::NextHop& a, const fib::NextHop& b)
+{
+  size_t queueA = a.getFace()->getQueueLength();
+  size_t queueB = b.getFace()->getQueueLength();
+  if (queueA != queueB) {
+    return queueA < queueB;
+  }
+  return a.getFace()->getOutRate() < b.getFace()->getOutRate();
+}
+
+void
+LoadBalanceStrategy::afterReceiveInterest(const Face& inFace,
+                                          const Interest& interest,
+                                          shared_ptr<fib::Entry> fibEntry,
+                                          shared_ptr<pit::Entry> pitEntry)
+{
+  const fib::NextHopList& nexthops = fibEntry->getNextHops();
+
+  RetxSuppression::Result suppression =
+      RetxSuppressionExponential::getDefault().decide(inFace, interest, *pitEntry);
+  if (suppression == RetxSuppression::SUPPRESS) {
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId()
+                           << " suppressed");
+    return;
+  }
+
+  NextHopSelection selection(*pitEntry, nexthops, inFace.getId(), time::steady_clock::now(),
+                             &LoadBalanceStrategy::isLessLoaded);
+
+  if (suppression == RetxSuppression::NEW) {
+    // find the least loaded eligible upstream
+    fib::NextHopList::const_iterator it = selection.getFirstEligible();
+    if (it == nexthops.end()) {
+      NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " noNextHop");
+      this->rejectPendingInterest(pitEntry);
+      return;
+    }
+
+    shared_ptr<Face> outFace = it->getFace();
+    this->sendInterest(pitEntry, outFace);
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId()
+                           << " newPitEntry-to=" << outFace->getId()
+                           << " queue=" << outFace->getQueueLength());
+    return;
+  }
+
+  // find the least loaded unused upstream except downstream
+  fib::NextHopList::const_iterator it = selection.getFirstUnused();
+  if (it != nexthops.end()) {
+    shared_ptr<Face> outFace = it->getFace();
+    this->sendInterest(pitEntry, outFace);
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId()
+                           << " retransmit-unused-to=" << outFace->getId());
+    return;
+  }
+
+  // find an eligible upstream that is used earliest
+  it = selection.getEarliestOutRecord();
+  if (it == nexthops.end()) {
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " retransmitNoNextHop");
+  }
+  else {
+    shared_ptr<Face> outFace = it->getFace();
+    this->sendInterest(pitEntry, outFace);
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId()
+                           << " retransmit-retry-to=" << outFace->getId());
+  }
+}
+
+} // namespace fw
+} // namespace nfd
@@ -0,0 +1,74 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_LOAD_BALANCE_STRATEGY_HPP
+#define NFD_DAEMON_FW_LOAD_BALANCE_STRATEGY_HPP
+
+#include "strategy.hpp"
+#include "retx-suppression-exponential.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief Load Balance strategy version 1
+ *
+ *  This strategy forwards a new Interest to the least loaded nexthop (except downstream).
+ *  A nexthop is less loaded than another if its face has fewer packets waiting for transmission
+ *  (Face::getQueueLength), or the same number of them and a lower outgoing rate
+ *  (Face::getOutRate).  FIB costs only break ties, e.g. among faces that do not estimate
+ *  their load.
+ *
+ *  If consumer retransmits the Interest (and is not suppressed according to exponential
+ *  backoff algorithm), the strategy forwards the Interest again to the least loaded nexthop
+ *  (except downstream) that is not previously used.  If all nexthops have been used,
+ *  the Interest is forwarded to the nexthop that was used earliest.
+ */
+class LoadBalanceStrategy : public Strategy
+{
+public:
+  LoadBalanceStrategy(Forwarder& forwarder, const Name& name = STRATEGY_NAME);
+
+  virtual void
+  afterReceiveInterest(const Face& inFace,
+                       const Interest& interest,
+                       shared_ptr<fib::Entry> fibEntry,
+                       shared_ptr<pit::Entry> pitEntry) DECL_OVERRIDE;
+
+public:
+  static const Name STRATEGY_NAME;
+
+private:
+  /** \return whether the face of nexthop \p a is less loaded than the face of nexthop \p b
+   *
+   *  Used as NextHopSelection::Preference.
+   */
+  static bool
+  isLessLoaded(const fib::NextHop& a, const fib::NextHop& b);
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_LOAD_BALANCE_STRATEGY_HPP
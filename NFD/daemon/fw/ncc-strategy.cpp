@@ -24,6 +24,7 @@
  */
 
 #include "ncc-strategy.hpp"
+#include "nexthop-selection.hpp"
 #include "core/random.hpp"
 #include <boost/random/uniform_int_distribution.hpp>
 
@@ -86,10 +87,8 @@ NccStrategy::afterReceiveInterest(const Face& inFace,
   }
   else {
     // use first eligible nexthop
-    auto firstEligibleNexthop = std::find_if(nexthops.begin(), nexthops.end(),
-        [&pitEntry] (const fib::NextHop& nexthop) {
-          return pitEntry->canForwardTo(*nexthop.getFace());
-        });
+    auto firstEligibleNexthop =
+      NextHopSelection(*pitEntry, nexthops, INVALID_FACEID).getFirstForwardable();
     if (firstEligibleNexthop != nexthops.end()) {
       this->sendInterest(pitEntry, firstEligibleNexthop->getFace());
     }
@@ -143,14 +142,11 @@ NccStrategy::doPropagate(weak_ptr<pit::Entry> pitEntryWeak, weak_ptr<fib::Entry>
   }
 
   const fib::NextHopList& nexthops = fibEntry->getNextHops();
-  bool isForwarded = false;
-  for (fib::NextHopList::const_iterator it = nexthops.begin(); it != nexthops.end(); ++it) {
-    shared_ptr<Face> face = it->getFace();
-    if (pitEntry->canForwardTo(*face)) {
-      isForwarded = true;
-      this->sendInterest(pitEntry, face);
-      break;
-    }
+  auto firstEligibleNexthop =
+    NextHopSelection(*pitEntry, nexthops, INVALID_FACEID).getFirstForwardable();
+  bool isForwarded = firstEligibleNexthop != nexthops.end();
+  if (isForwarded) {
+    this->sendInterest(pitEntry, firstEligibleNexthop->getFace());
   }
 
   if (isForwarded) {
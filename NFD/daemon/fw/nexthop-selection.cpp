@@ -0,0 +1,110 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "nexthop-selection.hpp"
+
+namespace nfd {
+namespace fw {
+
+NextHopSelection::NextHopSelection(const pit::Entry& pitEntry,
+                                   const fib::NextHopList& nexthops,
+                                   FaceId currentDownstream,
+                                   const time::steady_clock::TimePoint& now,
+                                   const Preference& isPreferred)
+  : m_firstEligible(nexthops.end())
+  , m_firstUnused(nexthops.end())
+  , m_earliestOutRecord(nexthops.end())
+  , m_firstForwardable(nexthops.end())
+{
+  // unexpired InRecords: canForwardTo needs one whose face differs from the nexthop
+  size_t nUnexpiredInRecords = 0;
+  const Face* unexpiredInFace = nullptr;
+  for (const pit::InRecord& inRecord : pitEntry.getInRecords()) {
+    if (inRecord.getExpiry() >= now) {
+      ++nUnexpiredInRecords;
+      unexpiredInFace = inRecord.getFace().get();
+    }
+  }
+
+  // scope is never violated by a local face, and is violated either by all or by none of
+  // non-local faces; determine the latter once, when the first non-local face is seen
+  enum { SCOPE_UNKNOWN, SCOPE_OK, SCOPE_VIOLATED } nonLocalScope = SCOPE_UNKNOWN;
+
+  time::steady_clock::TimePoint earliestRenewed = time::steady_clock::TimePoint::max();
+  const pit::OutRecordCollection& outRecords = pitEntry.getOutRecords();
+
+  // nexthops are visited in cost order, so without a preference a qualifying nexthop
+  // replaces the selected one only if none has been selected yet
+  auto isBetter = [&] (fib::NextHopList::const_iterator candidate,
+                       fib::NextHopList::const_iterator selected) {
+    return selected == nexthops.end() || (isPreferred && isPreferred(*candidate, *selected));
+  };
+
+  for (fib::NextHopList::const_iterator it = nexthops.begin(); it != nexthops.end(); ++it) {
+    const Face& upstream = *it->getFace();
+
+    bool violatesScope = false;
+    if (!upstream.isLocal()) {
+      if (nonLocalScope == SCOPE_UNKNOWN) {
+        nonLocalScope = pitEntry.violatesScope(upstream) ? SCOPE_VIOLATED : SCOPE_OK;
+      }
+      violatesScope = nonLocalScope == SCOPE_VIOLATED;
+    }
+    if (violatesScope) {
+      continue;
+    }
+
+    pit::OutRecordCollection::const_iterator outRecord = pitEntry.getOutRecord(upstream);
+    bool hasOutRecord = outRecord != outRecords.end();
+
+    if (isBetter(it, m_firstForwardable) &&
+        !(hasOutRecord && outRecord->getExpiry() >= now) &&
+        (nUnexpiredInRecords > 1 ||
+         (nUnexpiredInRecords == 1 && unexpiredInFace != &upstream))) {
+      m_firstForwardable = it;
+    }
+
+    if (upstream.getId() == currentDownstream) {
+      continue;
+    }
+
+    if (isBetter(it, m_firstEligible)) {
+      m_firstEligible = it;
+    }
+
+    if (isBetter(it, m_firstUnused) &&
+        !(hasOutRecord && outRecord->getExpiry() > now)) {
+      m_firstUnused = it;
+    }
+
+    if (hasOutRecord && outRecord->getLastRenewed() < earliestRenewed) {
+      m_earliestOutRecord = it;
+      earliestRenewed = outRecord->getLastRenewed();
+    }
+  }
+}
+
+} // namespace fw
+} // namespace nfd
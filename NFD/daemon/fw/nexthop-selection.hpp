@@ -0,0 +1,112 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_NEXTHOP_SELECTION_HPP
+#define NFD_DAEMON_FW_NEXTHOP_SELECTION_HPP
+
+#include "table/fib-entry.hpp"
+#include "table/pit-entry.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief helper that evaluates all nexthops of a FIB entry against a PIT entry in one pass
+ *
+ *  Calling pit::Entry::canForwardTo or pit::Entry::getOutRecord for every nexthop repeats
+ *  the scope check and the scans of InRecords and OutRecords per nexthop.  This helper
+ *  performs the scope check and the InRecord scan once, and looks up each nexthop's
+ *  OutRecord once, so the cost is linear in the number of nexthops.
+ *
+ *  Each getter returns an iterator into the evaluated NextHopList,
+ *  or its end() if no nexthop qualifies.  Since nexthops are sorted by cost,
+ *  "first" means "lowest cost", unless a Preference is given: then "first" means
+ *  "most preferred", and cost only breaks ties.
+ */
+class NextHopSelection
+{
+public:
+  /** \brief a strategy-defined order of nexthops
+   *  \return whether nexthop \p a is strictly preferred over nexthop \p b
+   */
+  typedef function<bool(const fib::NextHop& a, const fib::NextHop& b)> Preference;
+
+  /** \param currentDownstream incoming FaceId of current Interest, never eligible
+   *  \param now time used to decide whether in-records and out-records have expired
+   *  \param isPreferred order in which qualifying nexthops are compared; if empty,
+   *                     the lowest-cost qualifying nexthop is selected
+   */
+  NextHopSelection(const pit::Entry& pitEntry, const fib::NextHopList& nexthops,
+                   FaceId currentDownstream,
+                   const time::steady_clock::TimePoint& now = time::steady_clock::now(),
+                   const Preference& isPreferred = Preference());
+
+  /** \return first eligible nexthop
+   *
+   *  A nexthop is eligible if it is not the current downstream,
+   *  and forwarding to it would not violate scope.
+   */
+  fib::NextHopList::const_iterator
+  getFirstEligible() const
+  {
+    return m_firstEligible;
+  }
+
+  /** \return first eligible nexthop that does not have an unexpired OutRecord
+   */
+  fib::NextHopList::const_iterator
+  getFirstUnused() const
+  {
+    return m_firstUnused;
+  }
+
+  /** \return eligible nexthop whose OutRecord was renewed earliest
+   *
+   *  Nexthops without OutRecord are not considered.
+   */
+  fib::NextHopList::const_iterator
+  getEarliestOutRecord() const
+  {
+    return m_earliestOutRecord;
+  }
+
+  /** \return first nexthop to which pit::Entry::canForwardTo would return true
+   */
+  fib::NextHopList::const_iterator
+  getFirstForwardable() const
+  {
+    return m_firstForwardable;
+  }
+
+private:
+  fib::NextHopList::const_iterator m_firstEligible;
+  fib::NextHopList::const_iterator m_firstUnused;
+  fib::NextHopList::const_iterator m_earliestOutRecord;
+  fib::NextHopList::const_iterator m_firstForwardable;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_NEXTHOP_SELECTION_HPP
@@ -93,5 +93,12 @@ RetxSuppressionExponential::decide(const Face& inFace, const Interest& interest,
   return FORWARD;
 }
 
+const RetxSuppressionExponential&
+RetxSuppressionExponential::getDefault()
+{
+  static const RetxSuppressionExponential retxSuppression;
+  return retxSuppression;
+}
+
 } // namespace fw
 } // namespace nfd
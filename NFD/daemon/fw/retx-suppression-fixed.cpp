@@ -52,5 +52,12 @@ RetxSuppressionFixed::decide(const Face& inFace, const Interest& interest,
   return shouldSuppress ? SUPPRESS : FORWARD;
 }
 
+const RetxSuppressionFixed&
+RetxSuppressionFixed::getDefault()
+{
+  static const RetxSuppressionFixed retxSuppression;
+  return retxSuppression;
+}
+
 } // namespace fw
 } // namespace nfd
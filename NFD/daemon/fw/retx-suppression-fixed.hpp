@@ -47,6 +47,13 @@ public:
   decide(const Face& inFace, const Interest& interest,
          pit::Entry& pitEntry) const DECL_OVERRIDE;
 
+  /** \return instance with default parameters
+   *
+   *  The decision is stateless, so strategies that use default parameters share this instance.
+   */
+  static const RetxSuppressionFixed&
+  getDefault();
+
 public:
   static const time::milliseconds DEFAULT_MIN_RETX_INTERVAL;
 
@@ -48,15 +48,16 @@ registerStrategyImpl(const Name& strategyName, const StrategyCreateFunc& createF
   getStrategyFactories().insert({strategyName, createFunc});
 }
 
+const std::map<Name, StrategyCreateFunc>&
+getRegisteredStrategies()
+{
+  return getStrategyFactories();
+}
+
 void
 installStrategies(Forwarder& forwarder)
 {
-  StrategyChoice& sc = forwarder.getStrategyChoice();
-  for (const auto& pair : getStrategyFactories()) {
-    if (!sc.hasStrategy(pair.first, true)) {
-      sc.install(pair.second(forwarder));
-    }
-  }
+  forwarder.getStrategyChoice().installRegisteredStrategies(forwarder);
 }
 
 } // namespace fw
@@ -39,6 +39,10 @@ class Strategy;
 shared_ptr<Strategy>
 makeDefaultStrategy(Forwarder& forwarder);
 
+/** \brief make registered strategies available on the forwarder
+ *
+ *  Strategies are instantiated on first use, see StrategyChoice::installRegisteredStrategies.
+ */
 void
 installStrategies(Forwarder& forwarder);
 
@@ -48,6 +52,11 @@ typedef std::function<shared_ptr<Strategy>(Forwarder&)> StrategyCreateFunc;
 void
 registerStrategyImpl(const Name& strategyName, const StrategyCreateFunc& createFunc);
 
+/** \return registered strategies, keyed by exact strategyName
+ */
+const std::map<Name, StrategyCreateFunc>&
+getRegisteredStrategies();
+
 /** \brief registers a strategy to be installed later
  */
 template<typename S>
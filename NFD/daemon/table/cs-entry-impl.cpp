@@ -24,6 +24,7 @@
  */
 
 #include "cs-entry-impl.hpp"
+#include <cstring>
 
 namespace nfd {
 namespace cs {
@@ -63,22 +64,13 @@ EntryImpl::unsetUnsolicited()
 int
 compareQueryWithData(const Name& queryName, const Data& data)
 {
-  bool queryIsFullName = !queryName.empty() && queryName[-1].isImplicitSha256Digest();
-
-  int cmp = queryIsFullName ?
-            queryName.compare(0, queryName.size() - 1, data.getName()) :
-            queryName.compare(data.getName());
-
-  if (cmp != 0) { // Name without digest differs
+  int cmp = queryName.compare(data.getName());
+  if (cmp != 0) {
     return cmp;
   }
 
-  if (queryIsFullName) { // Name without digest equals, compare digest
-    return queryName[-1].compare(data.getFullName()[-1]);
-  }
-  else { // queryName is a proper prefix of Data fullName
-    return -1;
-  }
+  // queryName is a proper prefix of Data fullName
+  return -1;
 }
 
 int
@@ -89,7 +81,17 @@ compareDataWithData(const Data& lhs, const Data& rhs)
     return cmp;
   }
 
-  return lhs.getFullName()[-1].compare(rhs.getFullName()[-1]);
+  // Data packets with the same Name are ordered by wire size and then by wire encoding,
+  // so that the implicit digest (SHA-256 over the whole packet) is never needed for ordering
+  const Block& lhsWire = lhs.wireEncode();
+  const Block& rhsWire = rhs.wireEncode();
+  if (lhsWire.size() != rhsWire.size()) {
+    return lhsWire.size() < rhsWire.size() ? -1 : 1;
+  }
+  if (lhsWire.wire() == rhsWire.wire()) {
+    return 0;
+  }
+  return std::memcmp(lhsWire.wire(), rhsWire.wire(), lhsWire.size());
 }
 
 bool
@@ -73,6 +73,21 @@ public:
   void
   setLimit(size_t nMaxEntries);
 
+  /** \brief gets hard limit (in octets of Data wire encoding), 0 if unlimited
+   */
+  size_t
+  getByteLimit() const;
+
+  /** \brief sets hard limit (in octets of Data wire encoding)
+   *  \param nMaxBytes the limit, or 0 to bound CS by number of entries only
+   *  \post getByteLimit() == nMaxBytes
+   *  \post cs.getNBytes() <= getByteLimit() if getByteLimit() > 0
+   *
+   *  Both limits apply at the same time.  The policy may evict entries if necessary.
+   */
+  void
+  setByteLimit(size_t nMaxBytes);
+
   /** \brief emits when an entry is being evicted
    *
    *  A policy implementation should emit this signal to cause CS to erase the entry from its index.
@@ -147,17 +162,23 @@ protected:
   doBeforeUse(iterator i) = 0;
 
   /** \brief evicts zero or more entries
-   *  \post CS size does not exceed hard limit
+   *  \post CS size does not exceed hard limits
    */
   virtual void
   evictEntries() = 0;
 
+  /** \return whether CS exceeds either hard limit, i.e. evictEntries() should evict more
+   */
+  bool
+  isOverLimit() const;
+
 protected:
   DECLARE_SIGNAL_EMIT(beforeEvict)
 
 private:
   std::string m_policyName;
   size_t m_limit;
+  size_t m_byteLimit;
   Cs* m_cs;
 };
 
@@ -185,6 +206,12 @@ Policy::getLimit() const
   return m_limit;
 }
 
+inline size_t
+Policy::getByteLimit() const
+{
+  return m_byteLimit;
+}
+
 } // namespace cs
 } // namespace nfd
 
@@ -51,6 +51,7 @@ makeDefaultPolicy()
 }
 
 Cs::Cs(size_t nMaxPackets, unique_ptr<Policy> policy)
+  : m_nBytes(0)
 {
   this->setPolicyImpl(policy);
   m_policy->setLimit(nMaxPackets);
@@ -68,14 +69,28 @@ Cs::getLimit() const
   return m_policy->getLimit();
 }
 
+void
+Cs::setByteLimit(size_t nMaxBytes)
+{
+  m_policy->setByteLimit(nMaxBytes);
+}
+
+size_t
+Cs::getByteLimit() const
+{
+  return m_policy->getByteLimit();
+}
+
 void
 Cs::setPolicy(unique_ptr<Policy> policy)
 {
   BOOST_ASSERT(policy != nullptr);
   BOOST_ASSERT(m_policy != nullptr);
   size_t limit = m_policy->getLimit();
+  size_t byteLimit = m_policy->getByteLimit();
   this->setPolicyImpl(policy);
   m_policy->setLimit(limit);
+  m_policy->setByteLimit(byteLimit);
 }
 
 bool
@@ -110,6 +125,8 @@ Cs::insert(const Data& data, bool isUnsolicited)
     m_policy->afterRefresh(it);
   }
   else {
+    m_nBytes += data.wireEncode().size();
+    this->insertToIndex(it);
     m_policy->afterInsert(it);
   }
 
@@ -128,6 +145,19 @@ Cs::find(const Interest& interest,
   bool isRightmost = interest.getChildSelector() == 1;
   NFD_LOG_DEBUG("find " << prefix << (isRightmost ? " R" : " L"));
 
+  bool isFullName = !prefix.empty() && prefix[-1].isImplicitSha256Digest();
+  if (isFullName || !isRightmost) {
+    iterator match = isFullName ? this->findFullName(interest) : this->findExact(interest);
+    if (match != m_table.end()) {
+      ++m_lookupCounters.nExactNameHits;
+      NFD_LOG_DEBUG("  matching-exact " << match->getName());
+      m_policy->beforeUse(match);
+      hitCallback(interest, match->getData());
+      return;
+    }
+  }
+  ++m_lookupCounters.nRangeLookups;
+
   iterator first = m_table.lower_bound(prefix);
   iterator last = m_table.end();
   if (prefix.size() > 0) {
@@ -152,6 +182,37 @@ Cs::find(const Interest& interest,
   hitCallback(interest, match->getData());
 }
 
+iterator
+Cs::findExact(const Interest& interest) const
+{
+  // The leftmost entry with Name equal to Interest Name is also the leftmost entry under
+  // Interest Name, so if it can satisfy the Interest, it is what findLeftmost would return.
+  auto found = m_exactNameIndex.find(&interest.getName());
+  if (found == m_exactNameIndex.end() || !found->second->canSatisfy(interest)) {
+    return m_table.end();
+  }
+  return found->second;
+}
+
+iterator
+Cs::findFullName(const Interest& interest) const
+{
+  // Entries with the same Name are not ordered by implicit digest,
+  // so every entry with the Name without digest is a candidate.
+  Name name = interest.getName().getPrefix(-1);
+  auto found = m_exactNameIndex.find(&name);
+  if (found == m_exactNameIndex.end()) {
+    return m_table.end();
+  }
+
+  for (iterator it = found->second; it != m_table.end() && it->getName() == name; ++it) {
+    if (it->canSatisfy(interest)) {
+      return it;
+    }
+  }
+  return m_table.end();
+}
+
 iterator
 Cs::findLeftmost(const Interest& interest, iterator first, iterator last) const
 {
@@ -196,11 +257,44 @@ Cs::findRightmostAmongExact(const Interest& interest, iterator first, iterator l
   return find_last_if(first, last, bind(&EntryImpl::canSatisfy, _1, interest));
 }
 
+void
+Cs::insertToIndex(iterator it)
+{
+  const Name& name = it->getName();
+  ExactNameIndex::iterator found;
+  bool isNew = false;
+  std::tie(found, isNew) = m_exactNameIndex.emplace(&name, it);
+  if (!isNew && std::next(it) == found->second) {
+    // new entry is the leftmost one with this Name; rekey to its own Name
+    m_exactNameIndex.erase(found);
+    m_exactNameIndex.emplace(&name, it);
+  }
+}
+
+void
+Cs::eraseFromIndex(iterator it)
+{
+  const Name& name = it->getName();
+  auto found = m_exactNameIndex.find(&name);
+  BOOST_ASSERT(found != m_exactNameIndex.end());
+  if (found->second != it) {
+    return;
+  }
+
+  m_exactNameIndex.erase(found);
+  iterator next = std::next(it);
+  if (next != m_table.end() && next->getName() == name) {
+    m_exactNameIndex.emplace(&next->getName(), next);
+  }
+}
+
 void
 Cs::setPolicyImpl(unique_ptr<Policy>& policy)
 {
   m_policy = std::move(policy);
   m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (iterator it) {
+      this->eraseFromIndex(it);
+      m_nBytes -= it->getData().wireEncode().size();
       m_table.erase(it);
     });
 
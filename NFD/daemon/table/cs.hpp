@@ -30,7 +30,16 @@
  *  This ContentStore implementation consists of two data structures,
  *  a Table, and a set of cleanup queues.
  *
- *  The Table is a container (std::set) sorted by full Names of stored Data packets.
+ *  The Table is a container (std::set) sorted by Names of stored Data packets.
+ *  Data packets with the same Name are ordered by wire size and then by wire encoding,
+ *  rather than by implicit digest, so that inserting or refreshing a Data packet never
+ *  computes its digest.  A lookup with a full Name checks the entries with the Name
+ *  without digest one by one, and only their digests are computed.
+ *
+ *  Alongside the Table, an exact-Name index (hash table) maps each Name to the leftmost
+ *  Table entry with that Name.  A lookup with ChildSelector=leftmost whose Interest Name
+ *  equals the Name of a satisfying Data packet is answered with one probe of this index;
+ *  other lookups fall back to a range scan of the Table.
  *  Data packets are wrapped in Entry objects.
  *  Each Entry contain the Data packet itself,
  *  and a few addition attributes such as the staleness of the Data packet.
@@ -53,6 +62,7 @@
 #include "cs-entry-impl.hpp"
 #include <ndn-cxx/util/signal.hpp>
 #include <boost/iterator/transform_iterator.hpp>
+#include <unordered_map>
 
 namespace nfd {
 namespace cs {
@@ -105,6 +115,20 @@ public:
   size_t
   getLimit() const;
 
+  /** \brief changes capacity (in octets of Data wire encoding)
+   *  \param nMaxBytes the capacity, or 0 to bound CS by number of packets only
+   *
+   *  Byte capacity and packet capacity apply at the same time, so that experiments mixing
+   *  small and large Data packets can size the CS by memory.
+   */
+  void
+  setByteLimit(size_t nMaxBytes);
+
+  /** \return capacity (in octets of Data wire encoding), 0 if unlimited
+   */
+  size_t
+  getByteLimit() const;
+
   /** \brief changes cs replacement policy
    *  \pre size() == 0
    */
@@ -127,6 +151,39 @@ public:
     return m_table.size();
   }
 
+  /** \return total size of stored packets (in octets of Data wire encoding)
+   */
+  size_t
+  getNBytes() const
+  {
+    return m_nBytes;
+  }
+
+  /** \brief counts how lookups are answered
+   */
+  struct LookupCounters
+  {
+    LookupCounters()
+      : nExactNameHits(0)
+      , nRangeLookups(0)
+    {
+    }
+
+    /** \brief number of lookups answered by the exact-Name index
+     */
+    uint64_t nExactNameHits;
+
+    /** \brief number of lookups answered by a range scan of the Table
+     */
+    uint64_t nRangeLookups;
+  };
+
+  const LookupCounters&
+  getLookupCounters() const
+  {
+    return m_lookupCounters;
+  }
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   dump();
@@ -178,11 +235,63 @@ private: // find
   iterator
   findRightmostAmongExact(const Interest& interest, iterator first, iterator last) const;
 
+  /** \brief find leftmost match among entries with Names equal to Interest Name
+   *  \return the match, or m_table.end() if the exact-Name index cannot answer the lookup
+   */
+  iterator
+  findExact(const Interest& interest) const;
+
+  /** \brief find the entry whose full Name equals Interest Name
+   *  \pre Interest Name ends with an implicit digest component
+   *  \return the match, or m_table.end() if not found
+   */
+  iterator
+  findFullName(const Interest& interest) const;
+
+private: // exact-Name index
+  /** \brief adds a new Table entry to the exact-Name index
+   */
+  void
+  insertToIndex(iterator it);
+
+  /** \brief removes a Table entry, which is about to be erased, from the exact-Name index
+   */
+  void
+  eraseFromIndex(iterator it);
+
   void
   setPolicyImpl(unique_ptr<Policy>& policy);
 
 private:
+  struct NamePtrHash
+  {
+    size_t
+    operator()(const Name* name) const
+    {
+      return name->getPrefixHash(name->size());
+    }
+  };
+
+  struct NamePtrEqual
+  {
+    bool
+    operator()(const Name* lhs, const Name* rhs) const
+    {
+      return *lhs == *rhs;
+    }
+  };
+
+  /** \brief maps a Name to the leftmost Table entry with that Name
+   *
+   *  The key points to the Name of the Data in the mapped entry, so that the index stores
+   *  no copies of Names.
+   */
+  typedef std::unordered_map<const Name*, iterator, NamePtrHash, NamePtrEqual> ExactNameIndex;
+
   Table m_table;
+  ExactNameIndex m_exactNameIndex;
+  mutable LookupCounters m_lookupCounters;
+  size_t m_nBytes;
   unique_ptr<Policy> m_policy;
   ndn::util::signal::ScopedConnection m_beforeEvictConnection;
 };
@@ -105,8 +105,9 @@ DeadNonceList::add(const Name& name, uint32_t nonce)
 DeadNonceList::Entry
 DeadNonceList::makeEntry(const Name& name, uint32_t nonce)
 {
-  Block nameWire = name.wireEncode();
-  return CityHash64WithSeed(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size(),
+  // the name hash is cached in the Name, so the name is not encoded and rehashed
+  uint64_t nameHash = name.getPrefixHash(name.size());
+  return CityHash64WithSeed(reinterpret_cast<const char*>(&nameHash), sizeof(nameHash),
                             static_cast<uint64_t>(nonce));
 }
 
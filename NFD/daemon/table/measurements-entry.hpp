@@ -59,7 +59,6 @@ private:
 
 private: // lifetime
   time::steady_clock::TimePoint m_expiry;
-  scheduler::EventId m_cleanup;
   shared_ptr<name_tree::Entry> m_nameTreeEntry;
 
   friend class nfd::NameTree;
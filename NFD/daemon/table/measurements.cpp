@@ -35,9 +35,15 @@ using measurements::Entry;
 Measurements::Measurements(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_lastSweep(time::steady_clock::TimePoint::min())
 {
 }
 
+Measurements::~Measurements()
+{
+  scheduler::cancel(m_sweepEvent);
+}
+
 shared_ptr<Entry>
 Measurements::get(name_tree::Entry& nte)
 {
@@ -50,8 +56,8 @@ Measurements::get(name_tree::Entry& nte)
   ++m_nItems;
 
   entry->m_expiry = time::steady_clock::now() + getInitialLifetime();
-  entry->m_cleanup = scheduler::schedule(getInitialLifetime(),
-                                         bind(&Measurements::cleanup, this, ref(*entry)));
+  m_expiryQueue.emplace(entry->m_expiry, entry);
+  this->scheduleSweep(entry->m_expiry);
 
   return entry;
 }
@@ -147,9 +153,8 @@ Measurements::extendLifetime(Entry& entry,
     return;
   }
 
-  scheduler::cancel(entry.m_cleanup);
+  // the entry is queued with its earlier expiry time, and will be requeued by sweep()
   entry.m_expiry = expiry;
-  entry.m_cleanup = scheduler::schedule(lifetime, bind(&Measurements::cleanup, this, ref(entry)));
 }
 
 void
@@ -163,4 +168,46 @@ Measurements::cleanup(Entry& entry)
   }
 }
 
+void
+Measurements::scheduleSweep(const time::steady_clock::TimePoint& earliest)
+{
+  time::steady_clock::TimePoint when = std::max(earliest, m_lastSweep + getSweepInterval());
+  if (m_sweepEvent && m_sweepTime <= when) {
+    return;
+  }
+
+  scheduler::cancel(m_sweepEvent);
+  m_sweepTime = when;
+  m_sweepEvent = scheduler::schedule(std::max(when - time::steady_clock::now(),
+                                              time::nanoseconds::zero()),
+                                     bind(&Measurements::sweep, this));
+}
+
+void
+Measurements::sweep()
+{
+  m_sweepEvent.reset();
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  m_lastSweep = now;
+
+  while (!m_expiryQueue.empty() && m_expiryQueue.top().first <= now) {
+    shared_ptr<Entry> entry = m_expiryQueue.top().second.lock();
+    m_expiryQueue.pop();
+    if (entry == nullptr) {
+      continue;
+    }
+
+    if (entry->m_expiry > now) {
+      m_expiryQueue.emplace(entry->m_expiry, entry);
+    }
+    else {
+      this->cleanup(*entry);
+    }
+  }
+
+  if (!m_expiryQueue.empty()) {
+    this->scheduleSweep(m_expiryQueue.top().first);
+  }
+}
+
 } // namespace nfd
@@ -29,6 +29,8 @@
 #include "measurements-entry.hpp"
 #include "name-tree.hpp"
 
+#include <queue>
+
 namespace nfd {
 
 namespace fib {
@@ -71,6 +73,11 @@ public:
 } // namespace measurements
 
 /** \brief represents the Measurements table
+ *
+ *  Entries are removed when their lifetime is over.  Instead of a cleanup event per entry,
+ *  the table keeps a queue of entries ordered by expiry time, and one event sweeps all
+ *  expired entries from the front of the queue.  Extending the lifetime of an entry only
+ *  updates its expiry time; the entry is requeued when the sweep finds it still alive.
  */
 class Measurements : noncopyable
 {
@@ -78,6 +85,8 @@ public:
   explicit
   Measurements(NameTree& nametree);
 
+  ~Measurements();
+
   /** \brief find or insert a Measurements entry for \p name
    */
   shared_ptr<measurements::Entry>
@@ -124,6 +133,7 @@ public:
   /** \brief extend lifetime of an entry
    *
    *  The entry will be kept until at least now()+lifetime.
+   *  This does not schedule any event.
    */
   void
   extendLifetime(measurements::Entry& entry, const time::nanoseconds& lifetime);
@@ -131,10 +141,28 @@ public:
   size_t
   size() const;
 
+  /** \brief minimum time between two sweeps of expired entries
+   *
+   *  Entries expiring in quick succession are removed together, at the cost of keeping
+   *  them for at most this time longer than their lifetime.
+   */
+  static time::nanoseconds
+  getSweepInterval();
+
 private:
   void
   cleanup(measurements::Entry& entry);
 
+  /** \brief schedule the sweep event for the front of the expiry queue, if needed
+   */
+  void
+  scheduleSweep(const time::steady_clock::TimePoint& earliest);
+
+  /** \brief remove all expired entries
+   */
+  void
+  sweep();
+
   shared_ptr<measurements::Entry>
   get(name_tree::Entry& nte);
 
@@ -147,6 +175,26 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+
+  typedef std::pair<time::steady_clock::TimePoint, weak_ptr<measurements::Entry>> QueueItem;
+
+  struct QueueItemLater
+  {
+    bool
+    operator()(const QueueItem& a, const QueueItem& b) const
+    {
+      return a.first > b.first;
+    }
+  };
+
+  /** \brief every entry once, keyed by its expiry time when it was (re)queued
+   *
+   *  An entry's actual expiry time is never earlier than its key.
+   */
+  std::priority_queue<QueueItem, std::vector<QueueItem>, QueueItemLater> m_expiryQueue;
+  scheduler::EventId m_sweepEvent;
+  time::steady_clock::TimePoint m_sweepTime; ///< time of m_sweepEvent
+  time::steady_clock::TimePoint m_lastSweep;
 };
 
 inline time::nanoseconds
@@ -155,6 +203,12 @@ Measurements::getInitialLifetime()
   return time::seconds(4);
 }
 
+inline time::nanoseconds
+Measurements::getSweepInterval()
+{
+  return time::milliseconds(5);
+}
+
 inline size_t
 Measurements::size() const
 {
@@ -25,7 +25,6 @@
 
 #include "name-tree.hpp"
 #include "core/logger.hpp"
-#include "core/city-hash.hpp"
 
 #include <boost/concept/assert.hpp>
 #include <boost/concept_check.hpp>
@@ -48,67 +47,16 @@ BOOST_CONCEPT_ASSERT((boost::DefaultConstructible<NameTree::const_iterator>));
 
 namespace name_tree {
 
-class Hash32
-{
-public:
-  static size_t
-  compute(const char* buffer, size_t length)
-  {
-    return static_cast<size_t>(CityHash32(buffer, length));
-  }
-};
-
-class Hash64
-{
-public:
-  static size_t
-  compute(const char* buffer, size_t length)
-  {
-    return static_cast<size_t>(CityHash64(buffer, length));
-  }
-};
-
-typedef boost::mpl::if_c<sizeof(size_t) >= 8, Hash64, Hash32>::type CityHash;
-
-// Interface of different hash functions
 size_t
 computeHash(const Name& prefix)
 {
-  prefix.wireEncode();  // guarantees prefix's wire buffer is not empty
-
-  size_t hashValue = 0;
-  size_t hashUpdate = 0;
-
-  for (Name::const_iterator it = prefix.begin(); it != prefix.end(); it++)
-    {
-      const char* wireFormat = reinterpret_cast<const char*>( it->wire() );
-      hashUpdate = CityHash::compute(wireFormat, it->size());
-      hashValue ^= hashUpdate;
-    }
-
-  return hashValue;
+  return prefix.getPrefixHash(prefix.size());
 }
 
 std::vector<size_t>
 computeHashSet(const Name& prefix)
 {
-  prefix.wireEncode();  // guarantees prefix's wire buffer is not empty
-
-  size_t hashValue = 0;
-  size_t hashUpdate = 0;
-
-  std::vector<size_t> hashValueSet;
-  hashValueSet.push_back(hashValue);
-
-  for (Name::const_iterator it = prefix.begin(); it != prefix.end(); it++)
-    {
-      const char* wireFormat = reinterpret_cast<const char*>( it->wire() );
-      hashUpdate = CityHash::compute(wireFormat, it->size());
-      hashValue ^= hashUpdate;
-      hashValueSet.push_back(hashValue);
-    }
-
-  return hashValueSet;
+  return prefix.getPrefixHashes();
 }
 
 } // namespace name_tree
@@ -150,14 +98,15 @@ NameTree::~NameTree()
 
 // insert() is a private function, and called by only lookup()
 std::pair<shared_ptr<name_tree::Entry>, bool>
-NameTree::insert(const Name& prefix)
+NameTree::insert(const Name& name, size_t prefixLen)
 {
-  NFD_LOG_TRACE("insert " << prefix);
+  NFD_LOG_TRACE("insert " << name << " prefixLen=" << prefixLen);
 
-  size_t hashValue = name_tree::computeHash(prefix);
+  // prefix hashes are cached in the Name, so the name is hashed once for all its prefixes
+  size_t hashValue = name.getPrefixHash(prefixLen);
   size_t loc = hashValue % m_nBuckets;
 
-  NFD_LOG_TRACE("Name " << prefix << " hash value = " << hashValue << "  location = " << loc);
+  NFD_LOG_TRACE("Prefix hash value = " << hashValue << "  location = " << loc);
 
   // Check if this Name has been stored
   name_tree::Node* node = m_buckets[loc];
@@ -167,7 +116,11 @@ NameTree::insert(const Name& prefix)
     {
       if (static_cast<bool>(node->m_entry))
         {
-          if (prefix == node->m_entry->m_prefix)
+          const Name& entryPrefix = node->m_entry->m_prefix;
+          // isPrefixOf() is used to avoid making a copy of the prefix
+          if (hashValue == node->m_entry->getHash() &&
+              entryPrefix.size() == prefixLen &&
+              entryPrefix.isPrefixOf(name))
             {
               return std::make_pair(node->m_entry, false); // false: old entry
             }
@@ -175,7 +128,7 @@ NameTree::insert(const Name& prefix)
       nodePrev = node;
     }
 
-  NFD_LOG_TRACE("Did not find " << prefix << ", need to insert it to the table");
+  NFD_LOG_TRACE("Did not find the prefix, need to insert it to the table");
 
   // If no bucket is empty occupied, we need to create a new node, and it is
   // linked from nodePrev
@@ -192,7 +145,8 @@ NameTree::insert(const Name& prefix)
     }
 
   // Create a new Entry
-  shared_ptr<name_tree::Entry> entry(make_shared<name_tree::Entry>(prefix));
+  shared_ptr<name_tree::Entry> entry(make_shared<name_tree::Entry>(
+    prefixLen == name.size() ? name : name.getPrefix(prefixLen)));
   entry->setHash(hashValue);
   node->m_entry = entry; // link the Entry to its Node
   entry->m_node = node; // link the node to Entry. Used in eraseEntryIfEmpty.
@@ -211,10 +165,8 @@ NameTree::lookup(const Name& prefix)
 
   for (size_t i = 0; i <= prefix.size(); i++)
     {
-      Name temp = prefix.getPrefix(i);
-
       // insert() will create the entry if it does not exist.
-      std::pair<shared_ptr<name_tree::Entry>, bool> ret = insert(temp);
+      std::pair<shared_ptr<name_tree::Entry>, bool> ret = insert(prefix, i);
       entry = ret.first;
 
       if (ret.second == true)
@@ -277,7 +229,7 @@ NameTree::findLongestPrefixMatch(const Name& prefix, const name_tree::EntrySelec
   NFD_LOG_TRACE("findLongestPrefixMatch " << prefix);
 
   shared_ptr<name_tree::Entry> entry;
-  std::vector<size_t> hashValueSet = name_tree::computeHashSet(prefix);
+  const std::vector<size_t>& hashValueSet = prefix.getPrefixHashes();
 
   size_t hashValue = 0;
   size_t loc = 0;
@@ -295,6 +247,7 @@ NameTree::findLongestPrefixMatch(const Name& prefix, const name_tree::EntrySelec
             {
               // isPrefixOf() is used to avoid making a copy of the name
               if (hashValue == entry->getHash() &&
+                  entry->getPrefix().size() == static_cast<size_t>(i) &&
                   entry->getPrefix().isPrefixOf(prefix) &&
                   entrySelector(*entry))
                 {
@@ -33,7 +33,8 @@ namespace nfd {
 namespace name_tree {
 
 /**
- * \brief Compute the hash value of the given name prefix's WIRE FORMAT
+ * \brief Compute the hash value of the given name prefix
+ * \note The value is cached in the Name, see ndn::Name::getPrefixHash
  */
 size_t
 computeHash(const Name& prefix);
@@ -317,15 +318,16 @@ private:
   const_iterator                m_endIterator;
 
   /**
-   * \brief Create a Name Tree Entry if it does not exist, or return the existing
-   * Name Tree Entry address.
-   * \details Called by lookup() only.
+   * \brief Create a Name Tree Entry for the prefix of \p name with \p prefixLen
+   * components if it does not exist, or return the existing Name Tree Entry address.
+   * \details Called by lookup() only. The prefix Name is copied only when a new
+   * entry is created.
    * \return The first item is the Name Tree Entry address, the second item is
    * a bool value indicates whether this is an old entry (false) or a new
    * entry (true).
    */
   std::pair<shared_ptr<name_tree::Entry>, bool>
-  insert(const Name& prefix);
+  insert(const Name& name, size_t prefixLen);
 };
 
 inline NameTree::const_iterator::~const_iterator()
@@ -55,11 +55,8 @@ Entry::canForwardTo(const Face& face) const
 {
   time::steady_clock::TimePoint now = time::steady_clock::now();
 
-  bool hasUnexpiredOutRecord = std::any_of(m_outRecords.begin(), m_outRecords.end(),
-    [&face, &now] (const OutRecord& outRecord) {
-      return outRecord.getFace().get() == &face && outRecord.getExpiry() >= now;
-    });
-  if (hasUnexpiredOutRecord) {
+  OutRecordCollection::const_iterator outRecord = this->findOutRecord(face);
+  if (outRecord != m_outRecords.end() && outRecord->getExpiry() >= now) {
     return false;
   }
 
@@ -154,14 +151,36 @@ Entry::deleteInRecords()
   m_inRecords.clear();
 }
 
+OutRecordCollection::iterator
+Entry::findOutRecord(const Face& face) const
+{
+  OutRecordCollection& outRecords = const_cast<OutRecordCollection&>(m_outRecords);
+
+  if (!m_outRecordIndex.empty()) {
+    auto found = m_outRecordIndex.find(&face);
+    return found == m_outRecordIndex.end() ? outRecords.end() : found->second;
+  }
+
+  return std::find_if(outRecords.begin(), outRecords.end(),
+    [&face] (const OutRecord& outRecord) { return outRecord.getFace().get() == &face; });
+}
+
 OutRecordCollection::iterator
 Entry::insertOrUpdateOutRecord(shared_ptr<Face> face, const Interest& interest)
 {
-  auto it = std::find_if(m_outRecords.begin(), m_outRecords.end(),
-    [&face] (const OutRecord& outRecord) { return outRecord.getFace() == face; });
+  OutRecordCollection::iterator it = this->findOutRecord(*face);
   if (it == m_outRecords.end()) {
     m_outRecords.emplace_front(face);
     it = m_outRecords.begin();
+
+    if (!m_outRecordIndex.empty()) {
+      m_outRecordIndex.emplace(face.get(), it);
+    }
+    else if (m_outRecords.size() > OUT_RECORD_INDEX_THRESHOLD) {
+      for (auto i = m_outRecords.begin(); i != m_outRecords.end(); ++i) {
+        m_outRecordIndex.emplace(i->getFace().get(), i);
+      }
+    }
   }
 
   it->update(interest);
@@ -171,17 +190,23 @@ Entry::insertOrUpdateOutRecord(shared_ptr<Face> face, const Interest& interest)
 OutRecordCollection::const_iterator
 Entry::getOutRecord(const Face& face) const
 {
-  return std::find_if(m_outRecords.begin(), m_outRecords.end(),
-    [&face] (const OutRecord& outRecord) { return outRecord.getFace().get() == &face; });
+  return this->findOutRecord(face);
 }
 
 void
 Entry::deleteOutRecord(const Face& face)
 {
-  auto it = std::find_if(m_outRecords.begin(), m_outRecords.end(),
-    [&face] (const OutRecord& outRecord) { return outRecord.getFace().get() == &face; });
-  if (it != m_outRecords.end()) {
-    m_outRecords.erase(it);
+  OutRecordCollection::iterator it = this->findOutRecord(face);
+  if (it == m_outRecords.end()) {
+    return;
+  }
+
+  m_outRecords.erase(it);
+  if (!m_outRecordIndex.empty()) {
+    m_outRecordIndex.erase(&face);
+    if (m_outRecords.size() <= OUT_RECORD_INDEX_THRESHOLD / 2) {
+      m_outRecordIndex.clear();
+    }
   }
 }
 
@@ -163,6 +163,16 @@ public: // OutRecord
   bool
   hasUnexpiredOutRecords() const;
 
+  /** \brief number of OutRecords beyond which they are indexed by face
+   *
+   *  Below this, finding an OutRecord scans the (short) list of OutRecords.
+   */
+  static const size_t OUT_RECORD_INDEX_THRESHOLD = 8;
+
+private:
+  OutRecordCollection::iterator
+  findOutRecord(const Face& face) const;
+
 public:
   scheduler::EventId m_unsatisfyTimer;
   scheduler::EventId m_stragglerTimer;
@@ -171,6 +181,8 @@ private:
   shared_ptr<const Interest> m_interest;
   InRecordCollection m_inRecords;
   OutRecordCollection m_outRecords;
+  /// OutRecords by face, maintained only when there are many of them
+  std::unordered_map<const Face*, OutRecordCollection::iterator> m_outRecordIndex;
 
   static const Name LOCALHOST_NAME;
   static const Name LOCALHOP_NAME;
@@ -26,6 +26,7 @@
 #include "strategy-choice.hpp"
 #include "core/logger.hpp"
 #include "fw/strategy.hpp"
+#include "fw/strategy-registry.hpp"
 #include "pit-entry.hpp"
 #include "measurements-entry.hpp"
 
@@ -39,6 +40,7 @@ NFD_LOG_INIT("StrategyChoice");
 StrategyChoice::StrategyChoice(NameTree& nameTree, shared_ptr<Strategy> defaultStrategy)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_forwarder(nullptr)
 {
   this->setDefaultStrategy(defaultStrategy);
 }
@@ -47,10 +49,11 @@ bool
 StrategyChoice::hasStrategy(const Name& strategyName, bool isExact) const
 {
   if (isExact) {
-    return m_strategyInstances.count(strategyName) > 0;
+    return m_strategyInstances.count(strategyName) > 0 ||
+           (m_forwarder != nullptr && fw::getRegisteredStrategies().count(strategyName) > 0);
   }
   else {
-    return static_cast<bool>(this->getStrategy(strategyName));
+    return this->findStrategyName(strategyName) != nullptr;
   }
 }
 
@@ -60,7 +63,7 @@ StrategyChoice::install(shared_ptr<Strategy> strategy)
   BOOST_ASSERT(static_cast<bool>(strategy));
   const Name& strategyName = strategy->getName();
 
-  if (this->hasStrategy(strategyName, true)) {
+  if (m_strategyInstances.count(strategyName) > 0) {
     NFD_LOG_ERROR("install(" << strategyName << ") duplicate strategyName");
     return false;
   }
@@ -69,31 +72,83 @@ StrategyChoice::install(shared_ptr<Strategy> strategy)
   return true;
 }
 
-fw::Strategy*
-StrategyChoice::getStrategy(const Name& strategyName) const
+void
+StrategyChoice::installRegisteredStrategies(Forwarder& forwarder)
+{
+  m_forwarder = &forwarder;
+}
+
+/** \brief find strategyName in a table keyed by exact strategyName
+ *  \return exact match, or the latest version of unversioned strategyName, or nullptr
+ */
+template<typename Table>
+static const Name*
+findInTable(const Table& table, const Name& strategyName)
 {
-  fw::Strategy* candidate = nullptr;
-  for (auto it = m_strategyInstances.lower_bound(strategyName);
-       it != m_strategyInstances.end() && strategyName.isPrefixOf(it->first); ++it) {
+  const Name* candidate = nullptr;
+  for (auto it = table.lower_bound(strategyName);
+       it != table.end() && strategyName.isPrefixOf(it->first); ++it) {
     switch (it->first.size() - strategyName.size()) {
     case 0: // exact match
-      return it->second.get();
+      return &it->first;
     case 1: // unversioned strategyName matches versioned strategy
-      candidate = it->second.get();
+      candidate = &it->first;
       break;
     }
   }
   return candidate;
 }
 
+const Name*
+StrategyChoice::findStrategyName(const Name& strategyName) const
+{
+  const Name* installed = findInTable(m_strategyInstances, strategyName);
+  if (m_forwarder == nullptr) {
+    return installed;
+  }
+
+  const Name* registered = findInTable(fw::getRegisteredStrategies(), strategyName);
+  if (installed == nullptr || registered == nullptr) {
+    return installed != nullptr ? installed : registered;
+  }
+  if (installed->size() == strategyName.size()) {
+    return installed;
+  }
+  if (registered->size() == strategyName.size()) {
+    return registered;
+  }
+  // both are versioned, choose the latest version
+  return *registered < *installed ? installed : registered;
+}
+
+fw::Strategy*
+StrategyChoice::getStrategy(const Name& exactStrategyName)
+{
+  auto it = m_strategyInstances.find(exactStrategyName);
+  if (it != m_strategyInstances.end()) {
+    return it->second.get();
+  }
+
+  BOOST_ASSERT(m_forwarder != nullptr);
+  const auto& registered = fw::getRegisteredStrategies();
+  auto factory = registered.find(exactStrategyName);
+  BOOST_ASSERT(factory != registered.end());
+
+  NFD_LOG_DEBUG("instantiating " << exactStrategyName);
+  shared_ptr<Strategy> strategy = factory->second(*m_forwarder);
+  m_strategyInstances[exactStrategyName] = strategy;
+  return strategy.get();
+}
+
 bool
 StrategyChoice::insert(const Name& prefix, const Name& strategyName)
 {
-  Strategy* strategy = this->getStrategy(strategyName);
-  if (strategy == nullptr) {
+  const Name* exactStrategyName = this->findStrategyName(strategyName);
+  if (exactStrategyName == nullptr) {
     NFD_LOG_ERROR("insert(" << prefix << "," << strategyName << ") strategy not installed");
     return false;
   }
+  Strategy* strategy = this->getStrategy(*exactStrategyName);
 
   shared_ptr<name_tree::Entry> nte = m_nameTree.lookup(prefix);
   shared_ptr<Entry> entry = nte->getStrategyChoiceEntry();
@@ -31,6 +31,8 @@
 
 namespace nfd {
 
+class Forwarder;
+
 /** \brief represents the Strategy Choice table
  *
  *  The Strategy Choice table maintains available Strategy types,
@@ -62,6 +64,15 @@ public: // available Strategy types
   bool
   install(shared_ptr<fw::Strategy> strategy);
 
+  /** \brief make registered strategies available without instantiating them
+   *  \param forwarder forwarder passed to the constructor of registered strategies
+   *
+   *  A registered strategy (see fw::registerStrategy) is instantiated when insert() chooses it
+   *  for the first time, so that only strategies in use take memory.
+   */
+  void
+  installRegisteredStrategies(Forwarder& forwarder);
+
 public: // Strategy Choice table
   /** \brief set strategy of prefix to be strategyName
    *  \param strategyName the strategy to be used
@@ -144,11 +155,17 @@ public: // enumeration
   end() const;
 
 private:
-  /** \brief get Strategy instance by strategyName
+  /** \brief find exact strategyName of an installed or registered strategy
    *  \param strategyName a versioned or unversioned strategyName
+   *  \return exact strategyName, or nullptr if not found
+   */
+  const Name*
+  findStrategyName(const Name& strategyName) const;
+
+  /** \brief get Strategy instance by exact strategyName, instantiating it if necessary
    */
   fw::Strategy*
-  getStrategy(const Name& strategyName) const;
+  getStrategy(const Name& exactStrategyName);
 
   void
   setDefaultStrategy(shared_ptr<fw::Strategy> strategy);
@@ -167,6 +184,9 @@ private:
 
   typedef std::map<Name, shared_ptr<fw::Strategy> > StrategyInstanceTable;
   StrategyInstanceTable m_strategyInstances;
+
+  /// forwarder to instantiate registered strategies for, nullptr if they are not available
+  Forwarder* m_forwarder;
 };
 
 inline size_t
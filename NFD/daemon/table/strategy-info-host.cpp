@@ -30,7 +30,58 @@ namespace nfd {
 void
 StrategyInfoHost::clearStrategyInfo()
 {
-  m_items.clear();
+  for (Item& item : m_inlineItems) {
+    item.info.reset();
+  }
+  m_moreItems.clear();
+}
+
+void
+StrategyInfoHost::setItem(int typeId, shared_ptr<fw::StrategyInfo> info)
+{
+  Item* freeSlot = nullptr;
+  for (Item& item : m_inlineItems) {
+    if (item.info == nullptr) {
+      if (freeSlot == nullptr) {
+        freeSlot = &item;
+      }
+    }
+    else if (item.typeId == typeId) {
+      item.info = std::move(info);
+      return;
+    }
+  }
+  for (Item& item : m_moreItems) {
+    if (item.typeId == typeId) {
+      item.info = std::move(info);
+      return;
+    }
+  }
+
+  if (freeSlot != nullptr) {
+    freeSlot->typeId = typeId;
+    freeSlot->info = std::move(info);
+  }
+  else {
+    m_moreItems.push_back({typeId, std::move(info)});
+  }
+}
+
+void
+StrategyInfoHost::eraseItem(int typeId)
+{
+  for (Item& item : m_inlineItems) {
+    if (item.info != nullptr && item.typeId == typeId) {
+      item.info.reset();
+      return;
+    }
+  }
+  for (auto it = m_moreItems.begin(); it != m_moreItems.end(); ++it) {
+    if (it->typeId == typeId) {
+      m_moreItems.erase(it);
+      return;
+    }
+  }
 }
 
 } // namespace nfd
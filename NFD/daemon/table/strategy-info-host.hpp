@@ -30,7 +30,102 @@
 
 namespace nfd {
 
+/** \brief allocator that recycles memory of StrategyInfo objects
+ *
+ *  StrategyInfo items are created and destroyed together with PIT entries, so the same few
+ *  sizes are allocated over and over.  Freed blocks are kept on a per-type free list and
+ *  reused for the next item of the same type, instead of going to the heap allocator.
+ *  At most MAX_FREE_BLOCKS blocks are kept; further blocks are returned to the heap.
+ *
+ *  The free list is per thread, so that Forwarders running in different threads do not share
+ *  it; Forwarders in the same thread (e.g. all nodes of an ndnSIM simulation) do.
+ *  Blocks kept on the list of a thread are not released when the thread exits.
+ */
+template<typename T>
+class StrategyInfoAllocator
+{
+public:
+  typedef T value_type;
+
+  /** \brief maximum number of freed blocks kept for reuse, per type and thread
+   */
+  static const size_t MAX_FREE_BLOCKS = 1024;
+
+  template<typename U>
+  struct rebind
+  {
+    typedef StrategyInfoAllocator<U> other;
+  };
+
+  StrategyInfoAllocator() = default;
+
+  template<typename U>
+  StrategyInfoAllocator(const StrategyInfoAllocator<U>&)
+  {
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    if (n != 1 || s_freeList == nullptr) {
+      return static_cast<T*>(::operator new(n * sizeof(Block)));
+    }
+    Block* block = s_freeList;
+    s_freeList = block->next;
+    --s_nFreeBlocks;
+    return reinterpret_cast<T*>(block);
+  }
+
+  void
+  deallocate(T* p, size_t n)
+  {
+    if (n != 1 || s_nFreeBlocks >= MAX_FREE_BLOCKS) {
+      ::operator delete(p);
+      return;
+    }
+    Block* block = reinterpret_cast<Block*>(p);
+    block->next = s_freeList;
+    s_freeList = block;
+    ++s_nFreeBlocks;
+  }
+
+  template<typename U>
+  bool
+  operator==(const StrategyInfoAllocator<U>&) const
+  {
+    return true;
+  }
+
+  template<typename U>
+  bool
+  operator!=(const StrategyInfoAllocator<U>&) const
+  {
+    return false;
+  }
+
+private:
+  union Block
+  {
+    Block* next;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+  };
+
+  static thread_local Block* s_freeList;
+  static thread_local size_t s_nFreeBlocks;
+};
+
+template<typename T>
+thread_local typename StrategyInfoAllocator<T>::Block* StrategyInfoAllocator<T>::s_freeList =
+  nullptr;
+
+template<typename T>
+thread_local size_t StrategyInfoAllocator<T>::s_nFreeBlocks = 0;
+
 /** \brief base class for an entity onto which StrategyInfo objects may be placed
+ *
+ *  Items are kept in a few inline slots keyed by StrategyInfo type identifier,
+ *  so that hosts with one or two items (the common case) need no container allocation
+ *  and a lookup is a short linear scan.
  */
 class StrategyInfoHost
 {
@@ -55,6 +150,7 @@ public:
    *
    *  If no StrategyInfo of type T is stored, it's created with \p args;
    *  otherwise, the existing item is returned.
+   *  New items are allocated with StrategyInfoAllocator.
    */
   template<typename T, typename ...A>
   shared_ptr<T>
@@ -66,7 +162,40 @@ public:
   clearStrategyInfo();
 
 private:
-  std::map<int, shared_ptr<fw::StrategyInfo>> m_items;
+  struct Item
+  {
+    int typeId;
+    shared_ptr<fw::StrategyInfo> info; ///< nullptr if the slot is unused
+  };
+
+  /** \return the item of type \p typeId, or nullptr if it does not exist
+   */
+  const shared_ptr<fw::StrategyInfo>*
+  findItem(int typeId) const
+  {
+    for (const Item& item : m_inlineItems) {
+      if (item.info != nullptr && item.typeId == typeId) {
+        return &item.info;
+      }
+    }
+    for (const Item& item : m_moreItems) {
+      if (item.typeId == typeId) {
+        return &item.info;
+      }
+    }
+    return nullptr;
+  }
+
+  void
+  setItem(int typeId, shared_ptr<fw::StrategyInfo> info);
+
+  void
+  eraseItem(int typeId);
+
+private:
+  static const size_t N_INLINE_ITEMS = 2;
+  Item m_inlineItems[N_INLINE_ITEMS];
+  std::vector<Item> m_moreItems; ///< items that do not fit into m_inlineItems
 };
 
 
@@ -77,11 +206,11 @@ StrategyInfoHost::getStrategyInfo() const
   static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
                 "T must inherit from StrategyInfo");
 
-  auto it = m_items.find(T::getTypeId());
-  if (it == m_items.end()) {
+  const shared_ptr<fw::StrategyInfo>* info = this->findItem(T::getTypeId());
+  if (info == nullptr) {
     return nullptr;
   }
-  return static_pointer_cast<T, fw::StrategyInfo>(it->second);
+  return static_pointer_cast<T, fw::StrategyInfo>(*info);
 }
 
 template<typename T>
@@ -92,10 +221,10 @@ StrategyInfoHost::setStrategyInfo(shared_ptr<T> item)
                 "T must inherit from StrategyInfo");
 
   if (item == nullptr) {
-    m_items.erase(T::getTypeId());
+    this->eraseItem(T::getTypeId());
   }
   else {
-    m_items[T::getTypeId()] = item;
+    this->setItem(T::getTypeId(), std::move(item));
   }
 }
 
@@ -108,8 +237,8 @@ StrategyInfoHost::getOrCreateStrategyInfo(A&&... args)
 
   shared_ptr<T> item = this->getStrategyInfo<T>();
   if (!static_cast<bool>(item)) {
-    item = make_shared<T>(std::forward<A>(args)...);
-    this->setStrategyInfo(item);
+    item = std::allocate_shared<T>(StrategyInfoAllocator<T>(), std::forward<A>(args)...);
+    this->setItem(T::getTypeId(), item);
   }
   return item;
 }
@@ -46,6 +46,12 @@ FibUpdater::FibUpdater(Rib& rib, ndn::nfd::Controller& controller)
   rib.setFibUpdater(this);
 }
 
+void
+FibUpdater::setFibUpdateApplier(const FibUpdateApplier& applier)
+{
+  m_applyUpdate = applier;
+}
+
 void
 FibUpdater::computeAndSendFibUpdates(const RibUpdateBatch& batch,
                                      const FibUpdateSuccessCallback& onSuccess,
@@ -62,7 +68,12 @@ FibUpdater::computeAndSendFibUpdates(const RibUpdateBatch& batch,
 
   computeUpdates(batch);
 
-  sendUpdatesForBatchFaceId(onSuccess, onFailure);
+  if (m_applyUpdate != nullptr) {
+    applyUpdates(onSuccess, onFailure);
+  }
+  else {
+    sendUpdatesForBatchFaceId(onSuccess, onFailure);
+  }
 }
 
 void
@@ -127,21 +138,8 @@ FibUpdater::computeUpdatesForRegistration(const RibUpdate& update)
   }
   else {
     // New name in RIB
-    // Find prefix's parent
-    shared_ptr<RibEntry> parent = m_rib.findParent(prefix);
-
-    Rib::RibEntryList descendants = m_rib.findDescendantsForNonInsertedName(prefix);
-    Rib::RibEntryList children;
-
-    for (const auto& descendant : descendants) {
-      // If the child has the same parent as the new entry,
-      // the new entry must be the child's new parent
-      if (descendant->getParent() == parent) {
-        children.push_back(descendant);
-      }
-    }
-
-    createFibUpdatesForNewRibEntry(prefix, route, children);
+    // The highest entries under the prefix will become children of the new entry
+    createFibUpdatesForNewRibEntry(prefix, route, m_rib.findChildren(prefix));
   }
 }
 
@@ -231,6 +229,30 @@ FibUpdater::sendUpdatesForNonBatchFaceId(const FibUpdateSuccessCallback& onSucce
   }
 }
 
+void
+FibUpdater::applyUpdates(const FibUpdateSuccessCallback& onSuccess,
+                         const FibUpdateFailureCallback& onFailure)
+{
+  NFD_LOG_DEBUG("Applying " << m_updatesForBatchFaceId.size() + m_updatesForNonBatchFaceId.size()
+                << " updates to FIB directly");
+
+  for (const FibUpdate& update : m_updatesForBatchFaceId) {
+    if (!m_applyUpdate(update)) {
+      NFD_LOG_DEBUG("Failed to apply " << update << " (face not found)");
+      onFailure(ERROR_FACE_NOT_FOUND, "Face not found");
+      return;
+    }
+  }
+
+  for (const FibUpdate& update : m_updatesForNonBatchFaceId) {
+    if (!m_applyUpdate(update)) {
+      NFD_LOG_DEBUG("Skipping " << update << " (face not found)");
+    }
+  }
+
+  onSuccess(m_inheritedRoutes);
+}
+
 void
 FibUpdater::sendAddNextHopUpdate(const FibUpdate& update,
                                  const FibUpdateSuccessCallback& onSuccess,
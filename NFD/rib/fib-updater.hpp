@@ -57,8 +57,22 @@ public:
   typedef function<void(RibUpdateList inheritedRoutes)> FibUpdateSuccessCallback;
   typedef function<void(uint32_t code, const std::string& error)> FibUpdateFailureCallback;
 
+  /** \brief applies a FibUpdate to the FIB of a forwarder in the same process
+   *  \return false if the face of an ADD_NEXTHOP update does not exist, true otherwise
+   */
+  typedef function<bool(const FibUpdate& update)> FibUpdateApplier;
+
   FibUpdater(Rib& rib, ndn::nfd::Controller& controller);
 
+  /** \brief applies FibUpdates with \p applier instead of sending FIB management commands
+   *
+   *  When RIB and forwarder run in the same process, all updates of a RibUpdateBatch are
+   *  applied before computeAndSendFibUpdates returns, without encoding, signing and validating
+   *  a command for each of them.  An empty applier restores sending of commands.
+   */
+  void
+  setFibUpdateApplier(const FibUpdateApplier& applier);
+
   /** \brief computes FibUpdates using the provided RibUpdateBatch and then sends the
    *         updates to NFD's FIB
    *
@@ -104,6 +118,16 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   sendUpdatesForNonBatchFaceId(const FibUpdateSuccessCallback& onSuccess,
                                const FibUpdateFailureCallback& onFailure);
 
+  /** \brief applies the computed updates with the FibUpdateApplier, and calls onSuccess,
+  *          or onFailure if the face of the batch does not exist
+  *
+  *   Updates for the face of the batch are applied first, so that the batch fails without
+  *   changing the FIB.  Updates for other faces that no longer exist are skipped.
+  */
+  void
+  applyUpdates(const FibUpdateSuccessCallback& onSuccess,
+               const FibUpdateFailureCallback& onFailure);
+
   /** \brief sends a FibAddNextHopCommand to NFD using the parameters supplied by
   *          the passed update
   *
@@ -257,6 +281,7 @@ private:
 private:
   const Rib& m_rib;
   ndn::nfd::Controller& m_controller;
+  FibUpdateApplier m_applyUpdate;
   uint64_t m_batchFaceId;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
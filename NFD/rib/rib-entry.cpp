@@ -128,6 +128,20 @@ RibEntry::eraseRoute(RouteList::iterator route)
   return m_routes.end();
 }
 
+void
+RibEntry::setRouteFlags(RouteList::iterator route, uint64_t flags)
+{
+  if (route->flags & ndn::nfd::ROUTE_FLAG_CAPTURE) {
+    m_nRoutesWithCaptureSet--;
+  }
+
+  if (flags & ndn::nfd::ROUTE_FLAG_CAPTURE) {
+    m_nRoutesWithCaptureSet++;
+  }
+
+  route->flags = flags;
+}
+
 void
 RibEntry::addInheritedRoute(const Route& route)
 {
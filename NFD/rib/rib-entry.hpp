@@ -88,6 +88,13 @@ public:
   iterator
   eraseRoute(RouteList::iterator route);
 
+  /** \brief sets flags of a route in the entry's route list
+   *
+   *  Flags must be changed through this method, so that hasCapture() stays correct.
+   */
+  void
+  setRouteFlags(RouteList::iterator route, uint64_t flags);
+
   bool
   hasFaceId(const uint64_t faceId) const;
 
@@ -589,6 +589,12 @@ RibManager::onControlHeaderError(uint32_t code, const std::string& reason)
   BOOST_THROW_EXCEPTION(Error(os.str()));
 }
 
+void
+RibManager::setFibUpdateApplier(const FibUpdater::FibUpdateApplier& applier)
+{
+  m_fibUpdater.setFibUpdateApplier(applier);
+}
+
 void
 RibManager::enableLocalControlHeader()
 {
@@ -74,6 +74,13 @@ public:
   void
   setConfigFile(ConfigFile& configFile);
 
+  /** \brief applies FIB updates to a forwarder in the same process instead of sending
+   *         FIB management commands
+   *  \sa FibUpdater::setFibUpdateApplier
+   */
+  void
+  setFibUpdateApplier(const FibUpdater::FibUpdateApplier& applier);
+
   void
   onRibUpdateSuccess(const RibUpdate& update);
 
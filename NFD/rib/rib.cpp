@@ -42,6 +42,7 @@ sortRoutes(const Route& lhs, const Route& rhs)
 Rib::Rib()
   : m_nItems(0)
   , m_isUpdateInProgress(false)
+  , m_isSendingBatches(false)
 {
 }
 
@@ -97,7 +98,7 @@ Rib::insert(const Name& prefix, const Route& route)
       m_nItems++;
 
       // Register with face lookup table
-      m_faceMap[route.faceId].push_back(entry);
+      m_faceMap[route.faceId].insert(entry);
     }
     else {
       // Route exists, update fields
@@ -111,10 +112,12 @@ Rib::insert(const Name& prefix, const Route& route)
       // No checks are required here as the iterator needs to be updated in all cases.
       routeIt->setExpirationEvent(route.getExpirationEvent());
 
-      routeIt->flags = route.flags;
+      entry->setRouteFlags(routeIt, route.flags);
       routeIt->cost = route.cost;
       routeIt->expires = route.expires;
     }
+
+    invalidateRoutesForChildren(*entry);
   }
   else {
     // New name prefix
@@ -134,21 +137,23 @@ Rib::insert(const Name& prefix, const Route& route)
       parent->addChild(entry);
     }
 
-    RibEntryList children = findDescendants(prefix);
-
-    for (const auto& child : children) {
-      if (child->getParent() == parent) {
-        // Remove child from parent and inherit parent's child
-        if (parent != nullptr) {
-          parent->removeChild(child);
-        }
+    // Entries directly under the prefix were children of the parent, or had no parent
+    for (const auto& child : findChildren(prefix)) {
+      BOOST_ASSERT(child->getParent() == parent);
 
-        entry->addChild(child);
+      // Remove child from parent and inherit parent's child
+      if (parent != nullptr) {
+        parent->removeChild(child);
       }
+
+      entry->addChild(child);
+
+      // Child now inherits routes from the new entry
+      invalidateRoutesForChildren(*child);
     }
 
     // Register with face lookup table
-    m_faceMap[route.faceId].push_back(entry);
+    m_faceMap[route.faceId].insert(entry);
 
     // do something after inserting an entry
     afterInsertEntry(prefix);
@@ -172,9 +177,15 @@ Rib::erase(const Name& prefix, const Route& route)
 
       // If this RibEntry no longer has this faceId, unregister from face lookup table
       if (!entry->hasFaceId(route.faceId)) {
-        m_faceMap[route.faceId].remove(entry);
+        FaceLookupTable::iterator lookupIt = m_faceMap.find(route.faceId);
+        lookupIt->second.erase(entry);
+        if (lookupIt->second.empty()) {
+          m_faceMap.erase(lookupIt);
+        }
       }
 
+      invalidateRoutesForChildren(*entry);
+
       // If a RibEntry's route list is empty, remove it from the tree
       if (entry->getRoutes().size() == 0) {
         eraseEntry(ribIt);
@@ -237,10 +248,26 @@ Rib::findDescendantsForNonInsertedName(const Name& prefix) const
 {
   std::list<shared_ptr<RibEntry>> children;
 
-  for (std::pair<Name, shared_ptr<RibEntry>> pair : m_rib) {
-    if (prefix.isPrefixOf(pair.first)) {
-      children.push_back(pair.second);
-    }
+  // descendants are ordered right after the prefix, even if it does not exist in the RIB
+  for (RibTable::const_iterator it = m_rib.lower_bound(prefix);
+       it != m_rib.end() && prefix.isPrefixOf(it->first); ++it) {
+    children.push_back(it->second);
+  }
+
+  return children;
+}
+
+Rib::RibEntryList
+Rib::findChildren(const Name& prefix) const
+{
+  RibEntryList children;
+
+  RibTable::const_iterator it = m_rib.upper_bound(prefix);
+  while (it != m_rib.end() && prefix.isPrefixOf(it->first)) {
+    children.push_back(it->second);
+
+    // descendants of the child are ordered before the successor of its name
+    it = m_rib.lower_bound(it->first.getSuccessor());
   }
 
   return children;
@@ -276,8 +303,12 @@ Rib::eraseEntry(RibTable::iterator it)
     if (parent != nullptr) {
       parent->addChild(child);
     }
+
+    invalidateRoutesForChildren(*child);
   }
 
+  m_routesForChildren.erase(entry.get());
+
   RibTable::iterator nextIt = m_rib.erase(it);
 
   // do something after erasing an entry.
@@ -289,49 +320,68 @@ Rib::eraseEntry(RibTable::iterator it)
 Rib::RouteSet
 Rib::getAncestorRoutes(const RibEntry& entry) const
 {
-  RouteSet ancestorRoutes(&sortRoutes);
-
   shared_ptr<RibEntry> parent = entry.getParent();
 
-  while (parent != nullptr) {
-    for (const Route& route : parent->getRoutes()) {
-      if (route.isChildInherit()) {
-        ancestorRoutes.insert(route);
-      }
-    }
-
-    if (parent->hasCapture()) {
-      break;
-    }
-
-    parent = parent->getParent();
+  if (parent == nullptr) {
+    return RouteSet(&sortRoutes);
   }
 
-  return ancestorRoutes;
+  return getRoutesForChildren(*parent);
 }
 
 Rib::RouteSet
 Rib::getAncestorRoutes(const Name& name) const
 {
-  RouteSet ancestorRoutes(&sortRoutes);
-
   shared_ptr<RibEntry> parent = findParent(name);
 
-  while (parent != nullptr) {
-    for (const Route& route : parent->getRoutes()) {
-      if (route.isChildInherit()) {
-        ancestorRoutes.insert(route);
-      }
-    }
+  if (parent == nullptr) {
+    return RouteSet(&sortRoutes);
+  }
 
-    if (parent->hasCapture()) {
-      break;
+  return getRoutesForChildren(*parent);
+}
+
+const Rib::RouteSet&
+Rib::getRoutesForChildren(const RibEntry& entry) const
+{
+  auto it = m_routesForChildren.find(&entry);
+  if (it != m_routesForChildren.end()) {
+    return it->second;
+  }
+
+  RouteSet routes(&sortRoutes);
+
+  for (const Route& route : entry) {
+    if (route.isChildInherit()) {
+      routes.insert(route);
     }
+  }
+
+  // Routes of the entry take precedence over ancestor routes with the same face ID
+  if (!entry.hasCapture() && entry.getParent() != nullptr) {
+    const RouteSet& ancestorRoutes = getRoutesForChildren(*entry.getParent());
+    routes.insert(ancestorRoutes.begin(), ancestorRoutes.end());
+  }
+
+  return m_routesForChildren.emplace(&entry, std::move(routes)).first->second;
+}
+
+bool
+Rib::hasCachedRoutesForChildren(const RibEntry& entry) const
+{
+  return m_routesForChildren.count(&entry) > 0;
+}
 
-    parent = parent->getParent();
+void
+Rib::invalidateRoutesForChildren(const RibEntry& entry)
+{
+  if (m_routesForChildren.erase(&entry) == 0) {
+    return;
   }
 
-  return ancestorRoutes;
+  for (const shared_ptr<RibEntry>& child : entry.getChildren()) {
+    invalidateRoutesForChildren(*child);
+  }
 }
 
 void
@@ -376,32 +426,46 @@ Rib::addUpdateToQueue(const RibUpdate& update,
 void
 Rib::sendBatchFromQueue()
 {
-  if (m_updateBatches.empty() || m_isUpdateInProgress) {
+  // When FIB updates are applied in the same process, the batch is completed before
+  // computeAndSendFibUpdates returns; the loop below then sends the next batch
+  if (m_isSendingBatches) {
     return;
   }
+  m_isSendingBatches = true;
 
-  m_isUpdateInProgress = true;
+  try {
+    while (!m_updateBatches.empty() && !m_isUpdateInProgress) {
+      m_isUpdateInProgress = true;
 
-  UpdateQueueItem item = std::move(m_updateBatches.front());
-  m_updateBatches.pop_front();
+      UpdateQueueItem item = std::move(m_updateBatches.front());
+      m_updateBatches.pop_front();
 
-  RibUpdateBatch& batch = item.batch;
+      RibUpdateBatch& batch = item.batch;
 
-  // Until task #1698, each RibUpdateBatch contains exactly one RIB update
-  BOOST_ASSERT(batch.size() == 1);
+      // Until task #1698, each RibUpdateBatch contains exactly one RIB update
+      BOOST_ASSERT(batch.size() == 1);
 
-  const Rib::UpdateSuccessCallback& managerSuccessCallback = item.managerSuccessCallback;
-  const Rib::UpdateFailureCallback& managerFailureCallback = item.managerFailureCallback;
+      const Rib::UpdateSuccessCallback& managerSuccessCallback = item.managerSuccessCallback;
+      const Rib::UpdateFailureCallback& managerFailureCallback = item.managerFailureCallback;
 
-  m_fibUpdater->computeAndSendFibUpdates(batch,
-                                         bind(&Rib::onFibUpdateSuccess, this,
-                                              batch, _1, managerSuccessCallback),
-                                         bind(&Rib::onFibUpdateFailure, this,
-                                              managerFailureCallback, _1, _2));
+      m_fibUpdater->computeAndSendFibUpdates(batch,
+                                             bind(&Rib::onFibUpdateSuccess, this,
+                                                  batch, _1, managerSuccessCallback),
+                                             bind(&Rib::onFibUpdateFailure, this,
+                                                  managerFailureCallback, _1, _2));
 
-  if (m_onSendBatchFromQueue != nullptr) {
-    m_onSendBatchFromQueue(batch);
+      if (m_onSendBatchFromQueue != nullptr) {
+        m_onSendBatchFromQueue(batch);
+      }
+    }
   }
+  catch (...) {
+    // otherwise later calls would return early and never send the queue
+    m_isSendingBatches = false;
+    throw;
+  }
+
+  m_isSendingBatches = false;
 }
 
 void
@@ -482,10 +546,8 @@ Rib::findRoutesWithFaceId(uint64_t faceId)
     return routes;
   }
 
-  RibEntryList& ribEntries = lookupIt->second;
-
   // For each RIB entry that has faceId
-  for (const shared_ptr<RibEntry>& entry : ribEntries) {
+  for (const shared_ptr<RibEntry>& entry : lookupIt->second) {
     // Find the routes in the entry
     for (const Route& route : *entry) {
       if (route.faceId == faceId) {
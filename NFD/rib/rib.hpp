@@ -48,10 +48,22 @@ public:
   typedef std::list<shared_ptr<RibEntry>> RibEntryList;
   typedef std::map<Name, shared_ptr<RibEntry>> RibTable;
   typedef RibTable::const_iterator const_iterator;
-  typedef std::map<uint64_t, std::list<shared_ptr<RibEntry>>> FaceLookupTable;
   typedef bool (*RouteComparePredicate)(const Route&, const Route&);
   typedef std::set<Route, RouteComparePredicate> RouteSet;
 
+  /** \brief orders RIB entries by name
+   */
+  struct RibEntryNameCompare
+  {
+    bool
+    operator()(const shared_ptr<RibEntry>& lhs, const shared_ptr<RibEntry>& rhs) const
+    {
+      return lhs->getName() < rhs->getName();
+    }
+  };
+
+  typedef std::map<uint64_t, std::set<shared_ptr<RibEntry>, RibEntryNameCompare>> FaceLookupTable;
+
   Rib();
 
   ~Rib();
@@ -97,6 +109,31 @@ public:
   std::list<shared_ptr<RibEntry>>
   findDescendantsForNonInsertedName(const Name& prefix) const;
 
+  /** \brief finds entries that are, or would be if the prefix existed in the RIB, children
+   *         of the prefix's entry
+   *
+   *  Descendants of each child are skipped, so the cost is proportional to the number of
+   *  children rather than to the size of the subtree.
+   *
+   *  \return{ a list of the highest entries under the passed prefix }
+   */
+  RibEntryList
+  findChildren(const Name& prefix) const;
+
+  /** \brief returns routes inherited from the parent of the name and the parent's ancestors
+   *
+   *  \note A parent is first found for the passed name before inherited routes are collected
+   *
+   *  \return{ a list of inherited routes }
+   */
+  RouteSet
+  getAncestorRoutes(const Name& name) const;
+
+  /** \return{ whether routes that children of the entry inherit are cached }
+   */
+  bool
+  hasCachedRoutesForChildren(const RibEntry& entry) const;
+
 public:
   typedef function<void()> UpdateSuccessCallback;
   typedef function<void(uint32_t code, const std::string& error)> UpdateFailureCallback;
@@ -183,14 +220,21 @@ private:
   RouteSet
   getAncestorRoutes(const RibEntry& entry) const;
 
-  /** \brief returns routes inherited from the parent of the name and the parent's ancestors
+  /** \brief returns routes that children of the entry inherit from the entry and its ancestors
    *
-   *  \note A parent is first found for the passed name before inherited routes are collected
+   *  The set is computed from the parent's set and cached, until routes of the entry or of its
+   *  ancestors change, or the entry is moved in the tree.
+   */
+  const RouteSet&
+  getRoutesForChildren(const RibEntry& entry) const;
+
+  /** \brief drops cached routes for children of the entry and of its descendants
    *
-   *  \return{ a list of inherited routes }
+   *  Cached sets are computed from the top down, so descendants of an entry without a
+   *  cached set have none either, and are not visited.
    */
-  RouteSet
-  getAncestorRoutes(const Name& name) const;
+  void
+  invalidateRoutesForChildren(const RibEntry& entry);
 
   /** \brief applies the passed inheritedRoutes and their actions to the corresponding RibEntries'
    *  inheritedRoutes lists
@@ -213,6 +257,10 @@ private:
   FaceLookupTable m_faceMap;
   FibUpdater* m_fibUpdater;
 
+  /** \brief cache of getRoutesForChildren
+   */
+  mutable std::unordered_map<const RibEntry*, RouteSet> m_routesForChildren;
+
   size_t m_nItems;
 
   friend class FibUpdater;
@@ -231,6 +279,11 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
 private:
   bool m_isUpdateInProgress;
+
+  /** \brief whether sendBatchFromQueue is running, used to send batches completed before
+   *         FibUpdater returns in a loop instead of recursively
+   */
+  bool m_isSendingBatches;
 };
 
 inline Rib::const_iterator
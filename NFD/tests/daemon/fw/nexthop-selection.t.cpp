@@ -0,0 +1,134 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/nexthop-selection.hpp"
+#include "fw/forwarder.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_FIXTURE_TEST_SUITE(FwNextHopSelection, UnitTestTimeFixture)
+
+BOOST_AUTO_TEST_CASE(Select)
+{
+  Forwarder forwarder;
+  shared_ptr<DummyFace> face1 = make_shared<DummyFace>();
+  shared_ptr<DummyFace> face2 = make_shared<DummyFace>();
+  shared_ptr<DummyFace> face3 = make_shared<DummyFace>();
+  shared_ptr<DummyFace> face4 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.addFace(face3);
+  forwarder.addFace(face4);
+
+  fib::Entry fibEntry("/");
+  fibEntry.addNextHop(face1, 10);
+  fibEntry.addNextHop(face2, 20);
+  fibEntry.addNextHop(face3, 30);
+  fibEntry.addNextHop(face4, 40);
+  const fib::NextHopList& nexthops = fibEntry.getNextHops();
+
+  shared_ptr<Interest> interest = makeInterest("/A");
+  pit::Entry pitEntry(*interest);
+  pitEntry.insertOrUpdateInRecord(face1, *interest);
+
+  NextHopSelection selection1(pitEntry, nexthops, face1->getId());
+  BOOST_REQUIRE(selection1.getFirstEligible() != nexthops.end());
+  BOOST_CHECK_EQUAL(selection1.getFirstEligible()->getFace(), face2);
+  BOOST_REQUIRE(selection1.getFirstUnused() != nexthops.end());
+  BOOST_CHECK_EQUAL(selection1.getFirstUnused()->getFace(), face2);
+  BOOST_CHECK(selection1.getEarliestOutRecord() == nexthops.end());
+  BOOST_REQUIRE(selection1.getFirstForwardable() != nexthops.end());
+  BOOST_CHECK_EQUAL(selection1.getFirstForwardable()->getFace(), face2);
+
+  pitEntry.insertOrUpdateOutRecord(face2, *interest);
+  this->advanceClocks(time::milliseconds(10));
+  pitEntry.insertOrUpdateOutRecord(face4, *interest);
+
+  NextHopSelection selection2(pitEntry, nexthops, face1->getId());
+  BOOST_REQUIRE(selection2.getFirstEligible() != nexthops.end());
+  BOOST_CHECK_EQUAL(selection2.getFirstEligible()->getFace(), face2);
+  BOOST_REQUIRE(selection2.getFirstUnused() != nexthops.end());
+  BOOST_CHECK_EQUAL(selection2.getFirstUnused()->getFace(), face3);
+  BOOST_REQUIRE(selection2.getEarliestOutRecord() != nexthops.end());
+  BOOST_CHECK_EQUAL(selection2.getEarliestOutRecord()->getFace(), face2);
+  BOOST_REQUIRE(selection2.getFirstForwardable() != nexthops.end());
+  BOOST_CHECK_EQUAL(selection2.getFirstForwardable()->getFace(), face3);
+
+  // agrees with pit::Entry::canForwardTo
+  for (fib::NextHopList::const_iterator it = nexthops.begin(); it != nexthops.end(); ++it) {
+    if (it == selection2.getFirstForwardable()) {
+      break;
+    }
+    BOOST_CHECK_EQUAL(pitEntry.canForwardTo(*it->getFace()), false);
+  }
+  BOOST_CHECK_EQUAL(pitEntry.canForwardTo(*face3), true);
+
+  pitEntry.insertOrUpdateOutRecord(face3, *interest);
+  NextHopSelection selection3(pitEntry, nexthops, face1->getId());
+  BOOST_CHECK(selection3.getFirstUnused() == nexthops.end());
+  BOOST_REQUIRE(selection3.getEarliestOutRecord() != nexthops.end());
+  BOOST_CHECK_EQUAL(selection3.getEarliestOutRecord()->getFace(), face2);
+  BOOST_CHECK(selection3.getFirstForwardable() == nexthops.end());
+}
+
+BOOST_AUTO_TEST_CASE(Scope)
+{
+  Forwarder forwarder;
+  shared_ptr<DummyFace> face1 = make_shared<DummyFace>();
+  shared_ptr<DummyFace> face2 = make_shared<DummyFace>();
+  shared_ptr<DummyLocalFace> face3 = make_shared<DummyLocalFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.addFace(face3);
+
+  fib::Entry fibEntry("/localhop");
+  fibEntry.addNextHop(face2, 10);
+  fibEntry.addNextHop(face3, 20);
+  const fib::NextHopList& nexthops = fibEntry.getNextHops();
+
+  // /localhop Interest from non-local face cannot go to non-local face
+  shared_ptr<Interest> interest = makeInterest("/localhop/A");
+  pit::Entry pitEntry(*interest);
+  pitEntry.insertOrUpdateInRecord(face1, *interest);
+
+  NextHopSelection selection(pitEntry, nexthops, face1->getId());
+  BOOST_REQUIRE(selection.getFirstEligible() != nexthops.end());
+  BOOST_CHECK_EQUAL(selection.getFirstEligible()->getFace(), face3);
+  BOOST_REQUIRE(selection.getFirstForwardable() != nexthops.end());
+  BOOST_CHECK_EQUAL(selection.getFirstForwardable()->getFace(), face3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
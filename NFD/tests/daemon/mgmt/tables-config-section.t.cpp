@@ -133,6 +133,40 @@ BOOST_AUTO_TEST_CASE(ValidCsMaxPackets)
   BOOST_CHECK_EQUAL(m_cs.getLimit(), 101);
 }
 
+BOOST_AUTO_TEST_CASE(ValidCsMaxBytes)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  cs_max_bytes 65536\n"
+    "}\n";
+
+  BOOST_REQUIRE_EQUAL(m_cs.getByteLimit(), 0);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_EQUAL(m_cs.getByteLimit(), 0);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(m_cs.getByteLimit(), 65536);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidValueCsMaxBytes)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  cs_max_bytes invalid\n"
+    "}\n";
+
+  const std::string expectedMsg =
+    "Invalid value for option \"cs_max_bytes\" in \"tables\" section";
+
+  BOOST_CHECK_EXCEPTION(runConfig(CONFIG, true),
+                        ConfigFile::Error,
+                        bind(&TablesConfigSectionFixture::validateException,
+                             this, _1, expectedMsg));
+}
+
 BOOST_AUTO_TEST_CASE(MissingValueCsMaxPackets)
 {
   const std::string CONFIG =
@@ -314,8 +314,131 @@ BOOST_AUTO_TEST_CASE(DigestExclude)
   CHECK_CS_FIND(1);
 }
 
+BOOST_AUTO_TEST_CASE(LookupCounters)
+{
+  insert(1, "ndn:/A");
+  insert(2, "ndn:/A/B");
+
+  startInterest("ndn:/A");
+  CHECK_CS_FIND(1);
+  BOOST_CHECK_EQUAL(m_cs.getLookupCounters().nExactNameHits, 1);
+  BOOST_CHECK_EQUAL(m_cs.getLookupCounters().nRangeLookups, 0);
+
+  startInterest("ndn:/A")
+    .setChildSelector(1);
+  CHECK_CS_FIND(2);
+  BOOST_CHECK_EQUAL(m_cs.getLookupCounters().nExactNameHits, 1);
+  BOOST_CHECK_EQUAL(m_cs.getLookupCounters().nRangeLookups, 1);
+
+  startInterest("ndn:/A")
+    .setMinSuffixComponents(2);
+  CHECK_CS_FIND(2);
+  BOOST_CHECK_EQUAL(m_cs.getLookupCounters().nExactNameHits, 1);
+  BOOST_CHECK_EQUAL(m_cs.getLookupCounters().nRangeLookups, 2);
+
+  startInterest("ndn:/C");
+  CHECK_CS_FIND(0);
+  BOOST_CHECK_EQUAL(m_cs.getLookupCounters().nExactNameHits, 1);
+  BOOST_CHECK_EQUAL(m_cs.getLookupCounters().nRangeLookups, 3);
+}
+
+BOOST_AUTO_TEST_CASE(ExactNameIndexLeftmost)
+{
+  std::vector<shared_ptr<Data>> packets;
+  for (uint32_t id = 1; id <= 3; ++id) {
+    shared_ptr<Data> data = makeData("ndn:/A");
+    data->setFreshnessPeriod(time::milliseconds(99999));
+    data->setContent(reinterpret_cast<const uint8_t*>(&id), sizeof(id));
+    data->wireEncode();
+    packets.push_back(data);
+  }
+  std::sort(packets.begin(), packets.end(),
+            [] (const shared_ptr<Data>& a, const shared_ptr<Data>& b) {
+              return a->getFullName() > b->getFullName();
+            });
+
+  // each insertion becomes the leftmost entry with Name /A
+  for (const shared_ptr<Data>& data : packets) {
+    m_cs.insert(*data);
+  }
+  uint32_t expected = *reinterpret_cast<const uint32_t*>(packets.back()->getContent().value());
+
+  startInterest("ndn:/A");
+  CHECK_CS_FIND(expected);
+  BOOST_CHECK_EQUAL(m_cs.getLookupCounters().nExactNameHits, 1);
+}
+
+BOOST_AUTO_TEST_CASE(ExactNameIndexEviction)
+{
+  m_cs.setLimit(3);
+  insert(1, "ndn:/A");
+  insert(2, "ndn:/A");
+  insert(3, "ndn:/B");
+
+  // default policy evicts fresh entries in insertion order
+  insert(4, "ndn:/C");
+  startInterest("ndn:/A");
+  CHECK_CS_FIND(2);
+
+  insert(5, "ndn:/D");
+  startInterest("ndn:/A");
+  CHECK_CS_FIND(0);
+
+  BOOST_CHECK_EQUAL(m_cs.getLookupCounters().nExactNameHits, 1);
+  BOOST_CHECK_EQUAL(m_cs.getLookupCounters().nRangeLookups, 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_CASE(ByteLimit)
+{
+  Cs cs(100);
+  BOOST_CHECK_EQUAL(cs.getByteLimit(), 0);
+
+  shared_ptr<Data> small = makeData("ndn:/small");
+  shared_ptr<Data> large = makeData("ndn:/large");
+  large->setContent(make_shared<ndn::Buffer>(2000));
+  signData(large);
+  size_t smallSize = small->wireEncode().size();
+  size_t largeSize = large->wireEncode().size();
+
+  cs.insert(*small);
+  cs.insert(*large);
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_EQUAL(cs.getNBytes(), smallSize + largeSize);
+
+  // lowering the byte limit evicts entries until the CS fits
+  cs.setByteLimit(largeSize);
+  BOOST_CHECK_EQUAL(cs.getByteLimit(), largeSize);
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  BOOST_CHECK_EQUAL(cs.getNBytes(), largeSize);
+
+  // a small packet does not fit next to the large one
+  cs.insert(*makeData("ndn:/small2"));
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  BOOST_CHECK_LE(cs.getNBytes(), largeSize);
+  cs.find(Interest("ndn:/large"),
+          bind([] { BOOST_CHECK(false); }),
+          bind([] { BOOST_CHECK(true); }));
+
+  // many small packets fit in the same budget
+  for (int i = 0; i < 5; ++i) {
+    cs.insert(*makeData(Name("ndn:/small").appendNumber(i)));
+  }
+  BOOST_CHECK_EQUAL(cs.size(), 6);
+  BOOST_CHECK_LE(cs.getNBytes(), largeSize);
+
+  // packet limit still applies
+  cs.setLimit(3);
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+
+  // byte limit carries over to another policy
+  Cs cs2;
+  cs2.setByteLimit(largeSize);
+  cs2.setPolicy(makeDefaultPolicy());
+  BOOST_CHECK_EQUAL(cs2.getByteLimit(), largeSize);
+}
+
 BOOST_AUTO_TEST_CASE(CachingPolicyNoCache)
 {
   Cs cs(3);
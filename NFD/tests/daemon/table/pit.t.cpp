@@ -247,6 +247,45 @@ BOOST_AUTO_TEST_CASE(EntryCanForwardTo)
   BOOST_CHECK_EQUAL(entry.canForwardTo(*face2), true);
 }
 
+BOOST_AUTO_TEST_CASE(EntryManyOutRecords)
+{
+  shared_ptr<Interest> interest = makeInterest("ndn:/pTdWX5ZmM");
+  pit::Entry entry(*interest);
+
+  std::vector<shared_ptr<Face>> faces;
+  for (size_t i = 0; i < pit::Entry::OUT_RECORD_INDEX_THRESHOLD * 3; ++i) {
+    faces.push_back(make_shared<DummyFace>());
+    entry.insertOrUpdateOutRecord(faces.back(), *interest);
+  }
+  BOOST_CHECK_EQUAL(entry.getOutRecords().size(), faces.size());
+
+  // updating an existing OutRecord does not add another one
+  entry.insertOrUpdateOutRecord(faces.front(), *interest);
+  BOOST_CHECK_EQUAL(entry.getOutRecords().size(), faces.size());
+
+  for (const shared_ptr<Face>& face : faces) {
+    pit::OutRecordCollection::const_iterator outRecord = entry.getOutRecord(*face);
+    BOOST_REQUIRE(outRecord != entry.getOutRecords().end());
+    BOOST_CHECK_EQUAL(outRecord->getFace(), face);
+  }
+
+  // delete OutRecords until the index is dropped
+  for (size_t i = 0; i < faces.size(); ++i) {
+    if (i % 8 != 7) {
+      entry.deleteOutRecord(*faces[i]);
+    }
+  }
+  BOOST_CHECK_EQUAL(entry.getOutRecords().size(), faces.size() / 8);
+  for (size_t i = 0; i < faces.size(); ++i) {
+    bool isDeleted = i % 8 != 7;
+    BOOST_CHECK_EQUAL(entry.getOutRecord(*faces[i]) == entry.getOutRecords().end(), isDeleted);
+  }
+
+  entry.insertOrUpdateInRecord(faces[0], *interest);
+  BOOST_CHECK_EQUAL(entry.canForwardTo(*faces[1]), true);
+  BOOST_CHECK_EQUAL(entry.canForwardTo(*faces[7]), false);
+}
+
 BOOST_AUTO_TEST_CASE(Insert)
 {
   Name name1("ndn:/5vzBNnMst");
@@ -0,0 +1,159 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "rib/rib.hpp"
+
+#include "tests/test-common.hpp"
+#include "fib-updates-common.hpp"
+
+namespace nfd {
+namespace rib {
+namespace tests {
+
+class DirectFibUpdatesFixture : public FibUpdatesFixture
+{
+public:
+  DirectFibUpdatesFixture()
+    : nSuccesses(0)
+    , nFailures(0)
+  {
+    // face 9 does not exist
+    fibUpdater.setFibUpdateApplier([this] (const FibUpdate& update) {
+        if (update.faceId == 9 && update.action == FibUpdate::ADD_NEXTHOP) {
+          return false;
+        }
+        appliedUpdates.push_back(update);
+        return true;
+      });
+  }
+
+  void
+  applyUpdate(RibUpdate::Action action, const Name& name, uint64_t faceId, uint64_t flags)
+  {
+    RibUpdate update;
+    update.setAction(action)
+          .setName(name)
+          .setRoute(createRoute(faceId, 0, 10, flags));
+
+    rib.beginApplyUpdate(update,
+                         [this] { ++nSuccesses; },
+                         [this] (uint32_t code, const std::string& error) {
+                           BOOST_CHECK_EQUAL(code, 410);
+                           ++nFailures;
+                         });
+  }
+
+  FibUpdater::FibUpdateList
+  getSortedAppliedUpdates()
+  {
+    FibUpdater::FibUpdateList updates;
+    updates.swap(appliedUpdates);
+    updates.sort(&compareNameFaceIdCostAction);
+    return updates;
+  }
+
+public:
+  FibUpdater::FibUpdateList appliedUpdates;
+  int nSuccesses;
+  int nFailures;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestFibUpdatesDirect, DirectFibUpdatesFixture)
+
+BOOST_AUTO_TEST_CASE(Register)
+{
+  applyUpdate(RibUpdate::REGISTER, "/a", 1, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+  BOOST_CHECK_EQUAL(nSuccesses, 1);
+  BOOST_CHECK(rib.find("/a") != rib.end());
+  BOOST_CHECK_EQUAL(getSortedAppliedUpdates().size(), 1);
+
+  // the route of "/a" is inherited by "/a/b"
+  applyUpdate(RibUpdate::REGISTER, "/a/b", 2, 0);
+  BOOST_CHECK_EQUAL(nSuccesses, 2);
+
+  FibUpdater::FibUpdateList updates = getSortedAppliedUpdates();
+  BOOST_REQUIRE_EQUAL(updates.size(), 2);
+  BOOST_CHECK_EQUAL(updates.front().name, "/a/b");
+  BOOST_CHECK_EQUAL(updates.front().faceId, 1);
+  BOOST_CHECK_EQUAL(updates.front().action, FibUpdate::ADD_NEXTHOP);
+  BOOST_CHECK_EQUAL(updates.back().name, "/a/b");
+  BOOST_CHECK_EQUAL(updates.back().faceId, 2);
+  BOOST_CHECK_EQUAL(rib.find("/a/b")->second->getInheritedRoutes().size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(FaceNotFound)
+{
+  applyUpdate(RibUpdate::REGISTER, "/a", 1, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+  getSortedAppliedUpdates();
+
+  applyUpdate(RibUpdate::REGISTER, "/a/b", 9, 0);
+  BOOST_CHECK_EQUAL(nSuccesses, 1);
+  BOOST_CHECK_EQUAL(nFailures, 1);
+  BOOST_CHECK(rib.find("/a/b") == rib.end());
+  BOOST_CHECK_EQUAL(getSortedAppliedUpdates().size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(RemoveFace)
+{
+  applyUpdate(RibUpdate::REGISTER, "/a", 1, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+  applyUpdate(RibUpdate::REGISTER, "/a/b", 2, 0);
+  applyUpdate(RibUpdate::REGISTER, "/a/b/c", 1, 0);
+  applyUpdate(RibUpdate::REGISTER, "/d", 1, 0);
+  getSortedAppliedUpdates();
+
+  // all batches are completed before beginRemoveFace returns
+  rib.beginRemoveFace(1);
+  BOOST_CHECK(rib.m_updateBatches.empty());
+  BOOST_CHECK(rib.findRoutesWithFaceId(1).empty());
+  BOOST_CHECK_EQUAL(rib.size(), 1);
+
+  // next hops of the destroyed face are removed from FIB by the forwarder itself
+  BOOST_CHECK_EQUAL(getSortedAppliedUpdates().size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CallbackThrows)
+{
+  RibUpdate update;
+  update.setAction(RibUpdate::REGISTER)
+        .setName("/a")
+        .setRoute(createRoute(1, 0, 10, 0));
+
+  BOOST_CHECK_THROW(rib.beginApplyUpdate(update,
+                                         [] { BOOST_THROW_EXCEPTION(std::runtime_error("")); },
+                                         nullptr),
+                    std::runtime_error);
+  BOOST_CHECK(rib.find("/a") != rib.end());
+
+  // the RIB still sends the following batches
+  applyUpdate(RibUpdate::REGISTER, "/b", 1, 0);
+  BOOST_CHECK_EQUAL(nSuccesses, 1);
+  BOOST_CHECK(rib.find("/b") != rib.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace rib
+} // namespace nfd
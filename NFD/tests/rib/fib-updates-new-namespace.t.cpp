@@ -191,6 +191,61 @@ BOOST_AUTO_TEST_CASE(Capture)
   BOOST_CHECK_EQUAL(update->action, FibUpdate::REMOVE_NEXTHOP);
 }
 
+BOOST_AUTO_TEST_CASE(AncestorChanged)
+{
+  insertRoute("/a", 2, 0, 50, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+  insertRoute("/a/b/c", 1, 0, 10, 0);
+  insertRoute("/a/b/c/x", 1, 0, 10, 0);
+
+  // "/a/b/c" gets a new parent, its descendants inherit from it
+  insertRoute("/a/b", 3, 0, 30, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+  clearFibUpdates();
+
+  // Should generate 3 updates, 1 for the inserted route and 2 from inheritance
+  insertRoute("/a/b/c/d", 4, 0, 10, 0);
+
+  FibUpdater::FibUpdateList updates = getSortedFibUpdates();
+  BOOST_REQUIRE_EQUAL(updates.size(), 3);
+
+  FibUpdater::FibUpdateList::const_iterator update = updates.begin();
+  BOOST_CHECK_EQUAL(update->name,  "/a/b/c/d");
+  BOOST_CHECK_EQUAL(update->faceId, 2);
+  BOOST_CHECK_EQUAL(update->cost, 50);
+  BOOST_CHECK_EQUAL(update->action, FibUpdate::ADD_NEXTHOP);
+
+  ++update;
+  BOOST_CHECK_EQUAL(update->name,  "/a/b/c/d");
+  BOOST_CHECK_EQUAL(update->faceId, 3);
+  BOOST_CHECK_EQUAL(update->cost, 30);
+  BOOST_CHECK_EQUAL(update->action, FibUpdate::ADD_NEXTHOP);
+
+  ++update;
+  BOOST_CHECK_EQUAL(update->name,  "/a/b/c/d");
+  BOOST_CHECK_EQUAL(update->faceId, 4);
+  BOOST_CHECK_EQUAL(update->cost, 10);
+  BOOST_CHECK_EQUAL(update->action, FibUpdate::ADD_NEXTHOP);
+
+  // "/a/b" is erased, "/a/b/c" inherits from "/a" again
+  eraseRoute("/a/b", 3, 0);
+  clearFibUpdates();
+
+  insertRoute("/a/b/c/e", 5, 0, 10, 0);
+
+  updates = getSortedFibUpdates();
+  BOOST_REQUIRE_EQUAL(updates.size(), 2);
+
+  update = updates.begin();
+  BOOST_CHECK_EQUAL(update->name,  "/a/b/c/e");
+  BOOST_CHECK_EQUAL(update->faceId, 2);
+  BOOST_CHECK_EQUAL(update->cost, 50);
+  BOOST_CHECK_EQUAL(update->action, FibUpdate::ADD_NEXTHOP);
+
+  ++update;
+  BOOST_CHECK_EQUAL(update->name,  "/a/b/c/e");
+  BOOST_CHECK_EQUAL(update->faceId, 5);
+  BOOST_CHECK_EQUAL(update->action, FibUpdate::ADD_NEXTHOP);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // NewNamespace
 
 BOOST_AUTO_TEST_SUITE_END() // FibUpdates
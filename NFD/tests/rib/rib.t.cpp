@@ -231,6 +231,32 @@ BOOST_AUTO_TEST_CASE(EraseRibEntry)
   BOOST_CHECK(ribEntry3->getParent() == ribEntry1);
 }
 
+BOOST_AUTO_TEST_CASE(FindRoutesWithFaceId)
+{
+  rib::Rib rib;
+
+  Route route1;
+  route1.faceId = 1;
+  route1.origin = 20;
+  Route route2;
+  route2.faceId = 2;
+  route2.origin = 20;
+
+  rib.insert("/b", route1);
+  rib.insert("/a", route1);
+  rib.insert("/a", route2);
+
+  std::list<Rib::NameAndRoute> routes = rib.findRoutesWithFaceId(1);
+  BOOST_REQUIRE_EQUAL(routes.size(), 2);
+  BOOST_CHECK_EQUAL(routes.front().first, "/a");
+  BOOST_CHECK_EQUAL(routes.back().first, "/b");
+
+  rib.erase("/a", route1);
+  rib.erase("/b", route1);
+  BOOST_CHECK_EQUAL(rib.findRoutesWithFaceId(1).size(), 0);
+  BOOST_CHECK_EQUAL(rib.findRoutesWithFaceId(2).size(), 1);
+}
+
 BOOST_AUTO_TEST_CASE(Basic)
 {
   rib::Rib rib;
@@ -21,10 +21,57 @@
 
 #include "ns3/core-module.h"
 #include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
 #include "ns3/ndnSIM-module.h"
 
+#include "model/ndn-app-face.hpp"
+#include "model/ndn-net-device-face.hpp"
+
 namespace ns3 {
 
+/**
+ * Print link drops, shaping drops, and goodput of consumers on the given nodes
+ */
+static void
+printMetrics(const NodeContainer& consumers, uint32_t payloadSize, double duration)
+{
+  uint64_t nLinkDrops = 0;
+  uint64_t nShapingDrops = 0;
+  for (NodeContainer::Iterator node = NodeContainer::GetGlobal().Begin();
+       node != NodeContainer::GetGlobal().End(); ++node) {
+    for (uint32_t i = 0; i < (*node)->GetNDevices(); ++i) {
+      Ptr<PointToPointNetDevice> device = DynamicCast<PointToPointNetDevice>((*node)->GetDevice(i));
+      if (device != 0) {
+        nLinkDrops += device->GetQueue()->GetTotalDroppedPackets();
+      }
+    }
+
+    for (const auto& face : (*node)->GetObject<ndn::L3Protocol>()->getForwarder()->getFaceTable()) {
+      auto netDeviceFace = std::dynamic_pointer_cast<ndn::NetDeviceFace>(face);
+      if (netDeviceFace != nullptr) {
+        // Interests dropped from a full shaping queue or expired in it
+        nShapingDrops += netDeviceFace->getNShapingDrops();
+        nShapingDrops += netDeviceFace->getNShapingExpirations();
+      }
+    }
+  }
+
+  // Data received by consumers are those their forwarders sent to application faces
+  uint64_t nConsumerData = 0;
+  for (NodeContainer::Iterator node = consumers.Begin(); node != consumers.End(); ++node) {
+    for (const auto& face : (*node)->GetObject<ndn::L3Protocol>()->getForwarder()->getFaceTable()) {
+      if (std::dynamic_pointer_cast<ndn::AppFace>(face) != nullptr) {
+        nConsumerData += face->getCounters().getNOutDatas();
+      }
+    }
+  }
+
+  std::cout << "LinkDrops\t" << nLinkDrops << std::endl
+            << "ShapingDrops\t" << nShapingDrops << std::endl
+            << "ConsumerData\t" << nConsumerData << std::endl
+            << "GoodputKbps\t" << nConsumerData * payloadSize * 8 / duration / 1000 << std::endl;
+}
+
 /**
  * This scenario simulates a grid topology (using topology reader module)
  *
@@ -43,12 +90,23 @@ namespace ns3 {
  * To run scenario and see what is happening, use the following command:
  *
  *     NS_LOG=ndn.Consumer:ndn.Producer ./waf --run=ndn-congestion-topo-plugin
+ *
+ * Consumers together request more Data than the bottleneck can carry.  At the end, the scenario
+ * prints the number of packets dropped from transmit queues of the links, the number of
+ * Interests dropped by Interest shaping, and the goodput (payload of Data received by the
+ * consumers).  To compare with hop-by-hop Interest shaping, which paces Interests on each face
+ * by the data rate of the reverse direction of the link, use:
+ *
+ *     ./waf --run="ndn-congestion-topo-plugin --shaping=1"
  */
 
 int
 main(int argc, char* argv[])
 {
+  bool isShapingEnabled = false;
+
   CommandLine cmd;
+  cmd.AddValue("shaping", "Enable hop-by-hop Interest shaping", isShapingEnabled);
   cmd.Parse(argc, argv);
 
   AnnotatedTopologyReader topologyReader("", 25);
@@ -58,6 +116,7 @@ main(int argc, char* argv[])
   // Install NDN stack on all nodes
   ndn::StackHelper ndnHelper;
   ndnHelper.SetOldContentStore("ns3::ndn::cs::Lru", "MaxSize", "10000");
+  ndnHelper.setFaceInterestShaping(isShapingEnabled);
   ndnHelper.InstallAll();
 
   // Choosing forwarding strategy
@@ -108,6 +167,10 @@ main(int argc, char* argv[])
   Simulator::Stop(Seconds(20.0));
 
   Simulator::Run();
+
+  NodeContainer consumers(consumer1, consumer2);
+  printMetrics(consumers, 1024, 20.0);
+
   Simulator::Destroy();
 
   return 0;
@@ -39,6 +39,7 @@
 #include "ns3/data-rate.h"
 
 #include "daemon/mgmt/fib-manager.hpp"
+#include "daemon/fw/forwarder.hpp"
 #include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
 #include "ns3/ndnSIM/helper/ndn-stack-helper.hpp"
 
@@ -52,6 +53,19 @@ void
 FibHelper::AddNextHop(const ControlParameters& parameters, Ptr<Node> node)
 {
   NS_LOG_DEBUG("Add Next Hop command was initialized");
+  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
+  if (l3protocol->isDataPlaneOnly()) {
+    shared_ptr<nfd::Forwarder> forwarder = l3protocol->getForwarder();
+    shared_ptr<Face> face = forwarder->getFace(parameters.getFaceId());
+    if (face == nullptr) {
+      NS_FATAL_ERROR("Face with ID [" << parameters.getFaceId() << "] does not exist on node ["
+                                      << node->GetId() << "]");
+    }
+    forwarder->getFib().insert(parameters.getName()).first->addNextHop(face,
+                                                                       parameters.getCost());
+    return;
+  }
+
   Block encodedParameters(parameters.wireEncode());
 
   Name commandName("/localhost/nfd/fib");
@@ -61,7 +75,6 @@ FibHelper::AddNextHop(const ControlParameters& parameters, Ptr<Node> node)
   shared_ptr<Interest> command(make_shared<Interest>(commandName));
   StackHelper::getKeyChain().sign(*command);
 
-  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
   shared_ptr<nfd::FibManager> fibManager = l3protocol->getFibManager();
   fibManager->onFibRequest(*command);
 }
@@ -70,6 +83,20 @@ void
 FibHelper::RemoveNextHop(const ControlParameters& parameters, Ptr<Node> node)
 {
   NS_LOG_DEBUG("Remove Next Hop command was initialized");
+  Ptr<L3Protocol> L3protocol = node->GetObject<L3Protocol>();
+  if (L3protocol->isDataPlaneOnly()) {
+    shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
+    shared_ptr<Face> face = forwarder->getFace(parameters.getFaceId());
+    shared_ptr<nfd::fib::Entry> entry = forwarder->getFib().findExactMatch(parameters.getName());
+    if (face != nullptr && entry != nullptr) {
+      entry->removeNextHop(face);
+      if (!entry->hasNextHops()) {
+        forwarder->getFib().erase(*entry);
+      }
+    }
+    return;
+  }
+
   Block encodedParameters(parameters.wireEncode());
 
   Name commandName("/localhost/nfd/fib");
@@ -79,7 +106,6 @@ FibHelper::RemoveNextHop(const ControlParameters& parameters, Ptr<Node> node)
   shared_ptr<Interest> command(make_shared<Interest>(commandName));
   StackHelper::getKeyChain().sign(*command);
 
-  Ptr<L3Protocol> L3protocol = node->GetObject<L3Protocol>();
   shared_ptr<nfd::FibManager> fibManager = L3protocol->getFibManager();
   fibManager->onFibRequest(*command);
 }
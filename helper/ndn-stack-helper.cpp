@@ -22,7 +22,10 @@
 #include "ns3/log.h"
 #include "ns3/names.h"
 #include "ns3/string.h"
+#include "ns3/boolean.h"
 #include "ns3/point-to-point-net-device.h"
+#include "ns3/channel.h"
+#include "ns3/data-rate.h"
 
 #include "model/ndn-l3-protocol.hpp"
 #include "model/ndn-net-device-face.hpp"
@@ -42,6 +45,9 @@ namespace ndn {
 StackHelper::StackHelper()
   : m_needSetDefaultRoutes(false)
   , m_maxCsSize(100)
+  , m_maxCsBytes(0)
+  , m_faceAggregationWindow(0)
+  , m_isFaceInterestShapingEnabled(false)
 {
   setCustomNdnCxxClocks();
 
@@ -121,12 +127,36 @@ StackHelper::setCsSize(size_t maxSize)
   m_maxCsSize = maxSize;
 }
 
+void
+StackHelper::setCsByteLimit(size_t maxBytes)
+{
+  m_maxCsBytes = maxBytes;
+}
+
+void
+StackHelper::setDataPlaneOnly(bool isDataPlaneOnly)
+{
+  m_ndnFactory.Set("DataPlaneOnly", BooleanValue(isDataPlaneOnly));
+}
+
+void
+StackHelper::setFaceAggregationWindow(const Time& window)
+{
+  m_faceAggregationWindow = window;
+}
+
+void
+StackHelper::setFaceInterestShaping(bool isEnabled)
+{
+  m_isFaceInterestShapingEnabled = isEnabled;
+}
+
 Ptr<FaceContainer>
 StackHelper::Install(const NodeContainer& c) const
 {
   Ptr<FaceContainer> faces = Create<FaceContainer>();
   for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i) {
-    faces->AddAll(Install(*i));
+    faces->AddAll(aggregateStack(*i, createStack()));
   }
   return faces;
 }
@@ -140,21 +170,33 @@ StackHelper::InstallAll() const
 Ptr<FaceContainer>
 StackHelper::Install(Ptr<Node> node) const
 {
-  Ptr<FaceContainer> faces = Create<FaceContainer>();
-
-  if (node->GetObject<L3Protocol>() != 0) {
-    NS_FATAL_ERROR("Cannot re-install NDN stack on node "
-                   << node->GetId());
-    return 0;
-  }
+  return aggregateStack(node, createStack());
+}
 
+Ptr<L3Protocol>
+StackHelper::createStack() const
+{
   Ptr<L3Protocol> ndn = m_ndnFactory.Create<L3Protocol>();
   ndn->getConfig().put("tables.cs_max_packets", (m_maxCsSize == 0) ? 1 : m_maxCsSize);
+  ndn->getConfig().put("tables.cs_max_bytes", m_maxCsBytes);
 
   // Create and aggregate content store if NFD's contest store has been disabled
   if (m_maxCsSize == 0) {
     ndn->AggregateObject(m_contentStoreFactory.Create<ContentStore>());
   }
+  return ndn;
+}
+
+Ptr<FaceContainer>
+StackHelper::aggregateStack(Ptr<Node> node, Ptr<L3Protocol> ndn) const
+{
+  Ptr<FaceContainer> faces = Create<FaceContainer>();
+
+  if (node->GetObject<L3Protocol>() != 0) {
+    NS_FATAL_ERROR("Cannot re-install NDN stack on node "
+                   << node->GetId());
+    return 0;
+  }
 
   // Aggregate L3Protocol on node (must be after setting ndnSIM CS)
   node->AggregateObject(ndn);
@@ -223,6 +265,18 @@ StackHelper::PointToPointNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn,
 
   shared_ptr<NetDeviceFace> face = std::make_shared<NetDeviceFace>(node, device);
 
+  if (m_isFaceInterestShapingEnabled && device->GetChannel() != 0) {
+    // Data for Interests sent through the face come back from the other end of the link
+    Ptr<Channel> channel = device->GetChannel();
+    for (uint32_t i = 0; i < channel->GetNDevices(); ++i) {
+      DataRateValue rate;
+      if (channel->GetDevice(i) != device &&
+          channel->GetDevice(i)->GetAttributeFailSafe("DataRate", rate)) {
+        face->setInterestShapingRate(rate.Get());
+      }
+    }
+  }
+
   ndn->addFace(face);
   NS_LOG_LOGIC("Node " << node->GetId() << ": added NetDeviceFace as face #"
                        << face->getLocalUri());
@@ -296,6 +350,10 @@ StackHelper::createAndRegisterFace(Ptr<Node> node, Ptr<L3Protocol> ndn, Ptr<NetD
     face = DefaultNetDeviceCallback(node, ndn, device);
   }
 
+  if (!m_faceAggregationWindow.IsZero()) {
+    face->setAggregationWindow(m_faceAggregationWindow);
+  }
+
   if (m_needSetDefaultRoutes) {
     // default route with lowest priority possible
     FibHelper::AddRoute(node, "/", face, std::numeric_limits<int32_t>::max());
@@ -75,6 +75,50 @@ public:
   void
   setCsSize(size_t maxSize);
 
+  /**
+   * @brief Set maximum size for NFD's Content Store (in bytes of Data packets)
+   *
+   * The byte limit applies in addition to the limit set with setCsSize(); 0 (default) disables it.
+   */
+  void
+  setCsByteLimit(size_t maxBytes);
+
+  /**
+   * @brief Install data-plane only stacks: forwarder and its tables without NFD management
+   *        and RIB managers
+   *
+   * This considerably reduces memory and time needed to install the stack on large topologies.
+   * FibHelper, GlobalRoutingHelper, and StrategyChoiceHelper work as usual, but applications
+   * that register prefixes through NFD management protocol (e.g., using ndn-cxx Face) do not.
+   *
+   * @sa L3Protocol::isDataPlaneOnly
+   */
+  void
+  setDataPlaneOnly(bool isDataPlaneOnly);
+
+  /**
+   * @brief Set aggregation window of NetDeviceFaces created by the helper
+   *
+   * Interests and Data sent through a face within the window are packed into one link frame,
+   * up to the device MTU, reducing the number of simulated frames on links with many small
+   * packets.  Zero (default) disables aggregation.
+   *
+   * @sa NetDeviceFace::setAggregationWindow
+   */
+  void
+  setFaceAggregationWindow(const Time& window);
+
+  /**
+   * @brief Enable Interest shaping on point-to-point NetDeviceFaces created by the helper
+   *
+   * Each face paces outgoing Interests, so that the Data they bring back do not exceed the
+   * data rate of the other end of the link.  Disabled by default.
+   *
+   * @sa NetDeviceFace::setInterestShapingRate
+   */
+  void
+  setFaceInterestShaping(bool isEnabled);
+
   /**
    * @brief Set ndnSIM 1.0 content store implementation and its attributes
    * @param contentStoreClass string, representing class of the content store
@@ -222,6 +266,18 @@ private:
   shared_ptr<NetDeviceFace>
   createAndRegisterFace(Ptr<Node> node, Ptr<L3Protocol> ndn, Ptr<NetDevice> device) const;
 
+  /**
+   * @brief Create L3Protocol with the configured attributes, not yet aggregated to a node
+   */
+  Ptr<L3Protocol>
+  createStack() const;
+
+  /**
+   * @brief Aggregate L3Protocol to the node and create faces for its net devices
+   */
+  Ptr<FaceContainer>
+  aggregateStack(Ptr<Node> node, Ptr<L3Protocol> ndn) const;
+
 public:
   void
   setCustomNdnCxxClocks();
@@ -232,6 +288,9 @@ private:
 
   bool m_needSetDefaultRoutes;
   size_t m_maxCsSize;
+  size_t m_maxCsBytes;
+  Time m_faceAggregationWindow;
+  bool m_isFaceInterestShapingEnabled;
 
   typedef std::list<std::pair<TypeId, NetDeviceFaceCreateCallback>> NetDeviceCallbackList;
   NetDeviceCallbackList m_netDeviceCallbacks;
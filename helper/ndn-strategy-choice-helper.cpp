@@ -32,6 +32,19 @@ void
 StrategyChoiceHelper::sendCommand(const ControlParameters& parameters, Ptr<Node> node)
 {
   NS_LOG_DEBUG("Strategy choice command was initialized");
+  Ptr<L3Protocol> L3protocol = node->GetObject<L3Protocol>();
+  if (L3protocol->isDataPlaneOnly()) {
+    nfd::StrategyChoice& strategyChoice = L3protocol->getForwarder()->getStrategyChoice();
+    if (strategyChoice.insert(parameters.getName(), parameters.getStrategy())) {
+      NS_LOG_DEBUG("Forwarding strategy installed in node " << node->GetId());
+    }
+    else {
+      NS_LOG_ERROR("Forwarding strategy " << parameters.getStrategy()
+                   << " is not available on node " << node->GetId());
+    }
+    return;
+  }
+
   Block encodedParameters(parameters.wireEncode());
 
   Name commandName("/localhost/nfd/strategy-choice");
@@ -40,7 +53,6 @@ StrategyChoiceHelper::sendCommand(const ControlParameters& parameters, Ptr<Node>
 
   shared_ptr<Interest> command(make_shared<Interest>(commandName));
   StackHelper::getKeyChain().sign(*command);
-  Ptr<L3Protocol> L3protocol = node->GetObject<L3Protocol>();
   auto strategyChoiceManager = L3protocol->getStrategyChoiceManager();
   strategyChoiceManager->onStrategyChoiceRequest(*command);
   NS_LOG_DEBUG("Forwarding strategy installed in node " << node->GetId());
@@ -120,6 +120,9 @@ public:
   virtual uint32_t
   GetSize() const;
 
+  virtual uint64_t
+  GetSizeInBytes() const;
+
   virtual Ptr<Entry>
   Begin();
 
@@ -296,6 +299,18 @@ ContentStoreImpl<Policy>::GetSize() const
   return this->getPolicy().size();
 }
 
+template<class Policy>
+uint64_t
+ContentStoreImpl<Policy>::GetSizeInBytes() const
+{
+  uint64_t size = 0;
+  for (typename super::policy_container::const_iterator item = this->getPolicy().begin();
+       item != this->getPolicy().end(); item++) {
+    size += item->payload()->GetData()->wireEncode().size();
+  }
+  return size;
+}
+
 template<class Policy>
 Ptr<Entry>
 ContentStoreImpl<Policy>::Begin()
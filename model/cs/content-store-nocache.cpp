@@ -78,6 +78,12 @@ Nocache::GetSize() const
   return 0;
 }
 
+uint64_t
+Nocache::GetSizeInBytes() const
+{
+  return 0;
+}
+
 Ptr<cs::Entry>
 Nocache::Begin()
 {
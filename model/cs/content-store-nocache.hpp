@@ -67,6 +67,9 @@ public:
   virtual uint32_t
   GetSize() const;
 
+  virtual uint64_t
+  GetSizeInBytes() const;
+
   virtual Ptr<cs::Entry>
   Begin();
 
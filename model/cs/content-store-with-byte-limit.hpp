@@ -0,0 +1,112 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_CONTENT_STORE_WITH_BYTE_LIMIT_H_
+#define NDN_CONTENT_STORE_WITH_BYTE_LIMIT_H_
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "content-store-impl.hpp"
+
+#include "../../utils/trie/multi-policy.hpp"
+#include "custom-policies/byte-limit-policy.hpp"
+#include "ns3/uinteger.h"
+
+namespace ns3 {
+namespace ndn {
+namespace cs {
+
+/**
+ * @ingroup ndn-cs
+ * @brief Special content store realization that bounds total size of cached Data packets
+ *
+ * The byte budget (MaxBytes attribute) applies in addition to the number of packets
+ * (MaxSize attribute).  Set MaxSize to 0 to bound the content store by bytes only.
+ */
+template<class Policy>
+class ContentStoreWithByteLimit
+  : public ContentStoreImpl<ndnSIM::
+                              multi_policy_traits<boost::mpl::
+                                                    vector2<Policy,
+                                                            ndnSIM::byte_limit_policy_traits>>> {
+public:
+  typedef ContentStoreImpl<ndnSIM::multi_policy_traits<boost::mpl::
+                                                         vector2<Policy,
+                                                                 ndnSIM::byte_limit_policy_traits>>>
+    super;
+
+  typedef typename super::policy_container::template index<1>::type byte_limit_policy_container;
+
+  static TypeId
+  GetTypeId();
+
+  virtual uint64_t
+  GetSizeInBytes() const;
+
+private:
+  void
+  SetMaxBytes(uint64_t maxBytes)
+  {
+    this->getPolicy().template get<byte_limit_policy_container>().set_max_bytes(maxBytes);
+  }
+
+  uint64_t
+  GetMaxBytes() const
+  {
+    return this->getPolicy().template get<byte_limit_policy_container>().get_max_bytes();
+  }
+};
+
+//////////////////////////////////////////
+////////// Implementation ////////////////
+//////////////////////////////////////////
+
+template<class Policy>
+TypeId
+ContentStoreWithByteLimit<Policy>::GetTypeId()
+{
+  static TypeId tid =
+    TypeId(("ns3::ndn::cs::ByteLimit::" + Policy::GetName()).c_str())
+      .SetGroupName("Ndn")
+      .SetParent<super>()
+      .template AddConstructor<ContentStoreWithByteLimit<Policy>>()
+
+      .AddAttribute("MaxBytes",
+                    "Set maximum total size of Data packets in ContentStore (in bytes). "
+                    "If 0, size is not limited by bytes.",
+                    UintegerValue(0),
+                    MakeUintegerAccessor(&ContentStoreWithByteLimit<Policy>::GetMaxBytes,
+                                         &ContentStoreWithByteLimit<Policy>::SetMaxBytes),
+                    MakeUintegerChecker<uint64_t>());
+
+  return tid;
+}
+
+template<class Policy>
+uint64_t
+ContentStoreWithByteLimit<Policy>::GetSizeInBytes() const
+{
+  return this->getPolicy().template get<byte_limit_policy_container>().get_bytes();
+}
+
+} // namespace cs
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_CONTENT_STORE_WITH_BYTE_LIMIT_H_
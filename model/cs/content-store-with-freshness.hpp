@@ -34,6 +34,10 @@ namespace cs {
 /**
  * @ingroup ndn-cs
  * @brief Special content store realization that honors Freshness parameter in Data packets
+ *
+ * Expired entries are removed in batches: the freshness policy groups entries into ticks of
+ * the Resolution attribute, and one cleaning event per non-empty tick removes all entries that
+ * expired within it.  An entry is therefore removed up to Resolution after its expiration.
  */
 template<class Policy>
 class ContentStoreWithFreshness
@@ -65,6 +69,22 @@ private:
   inline void
   RescheduleCleaning();
 
+  inline void
+  ScheduleCleaning(const Time& time);
+
+  void
+  SetResolution(const Time& resolution)
+  {
+    this->getPolicy().template get<freshness_policy_container>().set_resolution(resolution);
+    RescheduleCleaning();
+  }
+
+  Time
+  GetResolution() const
+  {
+    return this->getPolicy().template get<freshness_policy_container>().get_resolution();
+  }
+
 private:
   static LogComponent g_log; ///< @brief Logging variable
 
@@ -89,6 +109,14 @@ ContentStoreWithFreshness<Policy>::GetTypeId()
                         .SetParent<super>()
                         .template AddConstructor<ContentStoreWithFreshness<Policy>>()
 
+                        .AddAttribute("Resolution",
+                                      "Granularity of expiration: entries are removed in batches "
+                                      "at most this long after they become stale",
+                                      TimeValue(MilliSeconds(10)),
+                                      MakeTimeAccessor(&ContentStoreWithFreshness<Policy>::SetResolution,
+                                                       &ContentStoreWithFreshness<Policy>::GetResolution),
+                                      MakeTimeChecker(TimeStep(1)))
+
     // trace stuff here
     ;
 
@@ -104,10 +132,33 @@ ContentStoreWithFreshness<Policy>::Add(shared_ptr<const Data> data)
     return false;
 
   NS_LOG_DEBUG(data->getName() << " added to cache");
-  RescheduleCleaning();
+
+  time::milliseconds freshness = data->getFreshnessPeriod();
+  if (freshness > time::milliseconds::zero()) {
+    const freshness_policy_container& freshnessPolicy =
+      this->getPolicy().template get<freshness_policy_container>();
+    ScheduleCleaning(freshnessPolicy.get_expire_time(Simulator::Now()
+                                                     + MilliSeconds(freshness.count())));
+  }
   return true;
 }
 
+template<class Policy>
+inline void
+ContentStoreWithFreshness<Policy>::ScheduleCleaning(const Time& time)
+{
+  if (m_cleanEvent.IsRunning()) {
+    if (m_scheduledCleaningTime <= time) {
+      return; // cleaning of an earlier tick will schedule this one
+    }
+    Simulator::Remove(m_cleanEvent); // just canceling would not clean up list of events
+  }
+
+  m_cleanEvent = Simulator::Schedule(time - Simulator::Now(),
+                                     &ContentStoreWithFreshness<Policy>::CleanExpired, this);
+  m_scheduledCleaningTime = time;
+}
+
 template<class Policy>
 inline void
 ContentStoreWithFreshness<Policy>::RescheduleCleaning()
@@ -115,27 +166,12 @@ ContentStoreWithFreshness<Policy>::RescheduleCleaning()
   const freshness_policy_container& freshness =
     this->getPolicy().template get<freshness_policy_container>();
 
-  if (freshness.size() > 0) {
-    Time nextStateTime =
-      freshness_policy_container::policy_base::get_freshness(&(*freshness.begin()));
-
-    if (m_scheduledCleaningTime.IsZero() ||      // if not yet scheduled
-        m_scheduledCleaningTime > nextStateTime) // if new item expire sooner than already scheduled
-    {
-      if (m_cleanEvent.IsRunning()) {
-        Simulator::Remove(m_cleanEvent); // just canceling would not clean up list of events
-      }
-
-      // NS_LOG_DEBUG ("Next event in: " << (nextStateTime - Now ()).ToDouble (Time::S) << "s");
-      m_cleanEvent = Simulator::Schedule(nextStateTime - Now(),
-                                         &ContentStoreWithFreshness<Policy>::CleanExpired, this);
-      m_scheduledCleaningTime = nextStateTime;
-    }
+  if (m_cleanEvent.IsRunning()) {
+    Simulator::Remove(m_cleanEvent); // just canceling would not clean up list of events
   }
-  else {
-    if (m_cleanEvent.IsRunning()) {
-      Simulator::Remove(m_cleanEvent); // just canceling would not clean up list of events
-    }
+
+  if (!freshness.empty()) {
+    ScheduleCleaning(std::max(freshness.get_next_expire_time(), Simulator::Now()));
   }
 }
 
@@ -148,23 +184,10 @@ ContentStoreWithFreshness<Policy>::CleanExpired()
 
   // NS_LOG_LOGIC (">> Cleaning: Total number of items:" << this->getPolicy ().size () << ", items
   // with freshness: " << freshness.size ());
-  Time now = Simulator::Now();
-
-  while (!freshness.empty()) {
-    typename freshness_policy_container::iterator entry = freshness.begin();
-
-    if (freshness_policy_container::policy_base::get_freshness(&(*entry))
-        <= now) // is the record stale?
-    {
-      super::erase(&(*entry));
-    }
-    else
-      break; // nothing else to do. All later records will not be stale
-  }
+  freshness.expire(Simulator::Now());
   // NS_LOG_LOGIC ("<< Cleaning: Total number of items:" << this->getPolicy ().size () << ", items
   // with freshness: " << freshness.size ());
 
-  m_scheduledCleaningTime = Time();
   RescheduleCleaning();
 }
 
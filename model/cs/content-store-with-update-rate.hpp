@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_CONTENT_STORE_WITH_UPDATE_RATE_H_
+#define NDN_CONTENT_STORE_WITH_UPDATE_RATE_H_
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "content-store-impl.hpp"
+
+#include "../../utils/trie/multi-policy.hpp"
+#include "custom-policies/update-rate-policy.hpp"
+#include "ns3/nstime.h"
+#include "ns3/uinteger.h"
+
+namespace ns3 {
+namespace ndn {
+namespace cs {
+
+/**
+ * @ingroup ndn-cs
+ * @brief Special content store realization that does not cache rapidly changing content
+ *        (placement policy)
+ *
+ * Update interval of each name is estimated from DataTimestamp of its Data packets.  Content
+ * updating more often than MinUpdateInterval is admitted with probability proportional to
+ * its update interval, content that is stable or not yet seen updating is always admitted.
+ */
+template<class Policy>
+class ContentStoreWithUpdateRate
+  : public ContentStoreImpl<ndnSIM::
+                              multi_policy_traits<boost::mpl::
+                                                    vector2<Policy,
+                                                            ndnSIM::update_rate_policy_traits>>> {
+public:
+  typedef ContentStoreImpl<ndnSIM::
+                             multi_policy_traits<boost::mpl::
+                                                   vector2<Policy,
+                                                           ndnSIM::update_rate_policy_traits>>>
+    super;
+
+  typedef typename super::policy_container::template index<1>::type update_rate_policy_container;
+
+  static TypeId
+  GetTypeId();
+
+  /**
+   * @brief Get number of Data packets admitted into the cache
+   */
+  uint64_t
+  GetNAdmitted() const
+  {
+    return this->getPolicy().template get<update_rate_policy_container>().get_n_admitted();
+  }
+
+  /**
+   * @brief Get number of Data packets not admitted because their content changes too often
+   *
+   * Each rejection is a cache write, and a potential validation of a stale cache hit, avoided.
+   */
+  uint64_t
+  GetNRejected() const
+  {
+    return this->getPolicy().template get<update_rate_policy_container>().get_n_rejected();
+  }
+
+  /**
+   * @brief Get number of observed content updates (Data with a newer DataTimestamp)
+   */
+  uint64_t
+  GetNUpdates() const
+  {
+    return this->getPolicy().template get<update_rate_policy_container>().get_n_updates();
+  }
+
+private:
+  void
+  SetMinUpdateInterval(Time interval)
+  {
+    this->getPolicy().template get<update_rate_policy_container>().set_min_update_interval(
+      interval.ToDouble(Time::S));
+  }
+
+  Time
+  GetMinUpdateInterval() const
+  {
+    return Seconds(
+      this->getPolicy().template get<update_rate_policy_container>().get_min_update_interval());
+  }
+
+  void
+  SetMaxHistorySize(uint32_t maxHistorySize)
+  {
+    this->getPolicy().template get<update_rate_policy_container>().set_max_history_size(
+      maxHistorySize);
+  }
+
+  uint32_t
+  GetMaxHistorySize() const
+  {
+    return this->getPolicy().template get<update_rate_policy_container>().get_max_history_size();
+  }
+};
+
+//////////////////////////////////////////
+////////// Implementation ////////////////
+//////////////////////////////////////////
+
+template<class Policy>
+TypeId
+ContentStoreWithUpdateRate<Policy>::GetTypeId()
+{
+  static TypeId tid =
+    TypeId(("ns3::ndn::cs::UpdateRate::" + Policy::GetName()).c_str())
+      .SetGroupName("Ndn")
+      .SetParent<super>()
+      .template AddConstructor<ContentStoreWithUpdateRate<Policy>>()
+
+      .AddAttribute("MinUpdateInterval",
+                    "Content updated more often than this interval is cached with probability "
+                    "proportional to its update interval. If 0, all content is cached.",
+                    TimeValue(Seconds(20)),
+                    MakeTimeAccessor(&ContentStoreWithUpdateRate<Policy>::GetMinUpdateInterval,
+                                     &ContentStoreWithUpdateRate<Policy>::SetMinUpdateInterval),
+                    MakeTimeChecker())
+
+      .AddAttribute("MaxHistorySize",
+                    "Maximum number of names for which update history is remembered",
+                    UintegerValue(10000),
+                    MakeUintegerAccessor(&ContentStoreWithUpdateRate<Policy>::GetMaxHistorySize,
+                                         &ContentStoreWithUpdateRate<Policy>::SetMaxHistorySize),
+                    MakeUintegerChecker<uint32_t>());
+
+  return tid;
+}
+
+} // namespace cs
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_CONTENT_STORE_WITH_UPDATE_RATE_H_
@@ -0,0 +1,178 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef BYTE_LIMIT_POLICY_H_
+#define BYTE_LIMIT_POLICY_H_
+
+/// @cond include_hidden
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Traits for policy that bounds total size of cached Data packets (in bytes)
+ *
+ * The policy does not keep its own eviction order.  It should be placed after the cache
+ * replacement policy in multi_policy_traits: when a new item does not fit into the byte
+ * budget, items are evicted in the order of the first policy (i.e., from its begin()) until
+ * the new item fits.  Items larger than the whole budget are not cached.
+ */
+struct byte_limit_policy_traits {
+  /// @brief Name that can be used to identify the policy (for NS-3 object model and logging)
+  static std::string
+  GetName()
+  {
+    return "ByteLimit";
+  }
+
+  struct policy_hook_type {
+  };
+
+  template<class Container>
+  struct container_hook {
+    struct type {
+    };
+  };
+
+  template<class Base, class Container, class Hook>
+  struct policy {
+    class type {
+    public:
+      typedef policy policy_base;
+      typedef Container parent_trie;
+
+      type(Base& base)
+        : base_(base)
+        , max_size_(100)
+        , max_bytes_(0)
+        , bytes_(0)
+      {
+      }
+
+      inline void
+      update(typename parent_trie::iterator item)
+      {
+        // do nothing
+      }
+
+      inline bool
+      insert(typename parent_trie::iterator item)
+      {
+        size_t size = get_size(item);
+        if (max_bytes_ != 0) {
+          if (size > max_bytes_) {
+            return false;
+          }
+
+          // the new item is not yet in the replacement policy, so it cannot be evicted here
+          while (bytes_ + size > max_bytes_ && base_.getPolicy().size() > 0) {
+            base_.erase(&(*base_.getPolicy().begin()));
+          }
+        }
+
+        bytes_ += size;
+        return true;
+      }
+
+      inline void
+      lookup(typename parent_trie::iterator item)
+      {
+        // do nothing
+      }
+
+      inline void
+      erase(typename parent_trie::iterator item)
+      {
+        bytes_ -= get_size(item);
+      }
+
+      inline void
+      clear()
+      {
+        bytes_ = 0;
+      }
+
+      inline void
+      set_max_size(size_t max_size)
+      {
+        max_size_ = max_size;
+      }
+
+      inline size_t
+      get_max_size() const
+      {
+        return max_size_;
+      }
+
+      /**
+       * @brief Set byte budget, evicting items if necessary (0 means no budget)
+       */
+      inline void
+      set_max_bytes(size_t max_bytes)
+      {
+        max_bytes_ = max_bytes;
+        while (max_bytes_ != 0 && bytes_ > max_bytes_ && base_.getPolicy().size() > 0) {
+          base_.erase(&(*base_.getPolicy().begin()));
+        }
+      }
+
+      inline size_t
+      get_max_bytes() const
+      {
+        return max_bytes_;
+      }
+
+      /**
+       * @brief Get total size of cached Data packets (in bytes)
+       */
+      inline size_t
+      get_bytes() const
+      {
+        return bytes_;
+      }
+
+    private:
+      static size_t
+      get_size(typename parent_trie::iterator item)
+      {
+        return item->payload()->GetData()->wireEncode().size();
+      }
+
+      type()
+        : base_(*((Base*)0)){};
+
+    private:
+      Base& base_;
+      size_t max_size_;
+      size_t max_bytes_;
+      size_t bytes_;
+    };
+  };
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // BYTE_LIMIT_POLICY_H_
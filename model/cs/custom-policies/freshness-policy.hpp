@@ -27,6 +27,9 @@
 #include <boost/intrusive/options.hpp>
 #include <boost/intrusive/list.hpp>
 
+#include <algorithm>
+#include <memory>
+
 #include <ns3/nstime.h>
 #include <ns3/simulator.h>
 #include <ns3/traced-callback.h>
@@ -37,6 +40,14 @@ namespace ndnSIM {
 
 /**
  * @brief Traits for freshness policy
+ *
+ * Items with positive FreshnessPeriod are kept in a hashed timing wheel: a ring of buckets,
+ * each covering one tick (resolution) of simulated time.  Insertion and removal are O(1), and
+ * expired items are removed in batches by sweeping whole ticks with expire().  An item expires
+ * at the end of the tick into which its expiration time falls, i.e. expiration is rounded up to
+ * the resolution.  Items expiring further than one revolution of the wheel share buckets with
+ * earlier items and are skipped until their tick comes.  An occupancy bitmap of the buckets lets
+ * get_next_expire_time() and expire() skip empty buckets a machine word at a time.
  */
 struct freshness_policy_traits {
   /// @brief Name that can be used to identify the policy (for NS-3 object model and logging)
@@ -46,7 +57,7 @@ struct freshness_policy_traits {
     return "Freshness";
   }
 
-  struct policy_hook_type : public boost::intrusive::set_member_hook<> {
+  struct policy_hook_type : public boost::intrusive::list_member_hook<> {
     Time timeWhenShouldExpire;
   };
 
@@ -58,6 +69,8 @@ struct freshness_policy_traits {
 
   template<class Base, class Container, class Hook>
   struct policy {
+    typedef boost::intrusive::list<Container, Hook> policy_container;
+
     static Time&
     get_freshness(typename Container::iterator item)
     {
@@ -72,28 +85,26 @@ struct freshness_policy_traits {
                policy_container::value_traits::to_node_ptr(*item))->timeWhenShouldExpire;
     }
 
-    template<class Key>
-    struct MemberHookLess {
-      bool
-      operator()(const Key& a, const Key& b) const
-      {
-        return get_freshness(&a) < get_freshness(&b);
-      }
-    };
-
-    typedef boost::intrusive::multiset<Container,
-                                       boost::intrusive::compare<MemberHookLess<Container>>,
-                                       Hook> policy_container;
-
-    class type : public policy_container {
+    class type {
     public:
       typedef policy policy_base; // to get access to get_freshness methods from outside
       typedef Container parent_trie;
 
+      /// @brief Number of buckets in the wheel (power of two)
+      static const size_t N_BUCKETS = 1024;
+
+      /// @brief Number of words in the occupancy bitmap
+      static const size_t N_WORDS = N_BUCKETS / 64;
+
       type(Base& base)
         : base_(base)
         , max_size_(100)
+        , resolution_(MilliSeconds(10))
+        , buckets_(new policy_container[N_BUCKETS])
+        , size_(0)
+        , last_tick_(0)
       {
+        std::fill_n(occupied_, N_WORDS, 0);
       }
 
       inline void
@@ -113,7 +124,7 @@ struct freshness_policy_traits {
           // controlled by the policy.
           // Note that .size() on this policy would return only the number of items with
           // non-infinite freshness policy
-          policy_container::insert(*item);
+          link(*item);
         }
 
         return true;
@@ -131,14 +142,18 @@ struct freshness_policy_traits {
         time::milliseconds freshness = item->payload()->GetData()->getFreshnessPeriod();
         if (freshness > time::milliseconds::zero()) {
           // erase only if freshness is positive (otherwise an item is not in the policy)
-          policy_container::erase(policy_container::s_iterator_to(*item));
+          unlink(*item);
         }
       }
 
       inline void
       clear()
       {
-        policy_container::clear();
+        for (size_t i = 0; i < N_BUCKETS; ++i) {
+          buckets_[i].clear();
+        }
+        std::fill_n(occupied_, N_WORDS, 0);
+        size_ = 0;
       }
 
       inline void
@@ -153,13 +168,172 @@ struct freshness_policy_traits {
         return max_size_;
       }
 
+      inline size_t
+      size() const
+      {
+        return size_;
+      }
+
+      inline bool
+      empty() const
+      {
+        return size_ == 0;
+      }
+
+      /**
+       * @brief Set duration of one tick of the wheel, re-bucketing items if necessary
+       */
+      inline void
+      set_resolution(const Time& resolution)
+      {
+        NS_ASSERT(resolution.IsStrictlyPositive());
+        if (resolution == resolution_)
+          return;
+
+        policy_container items;
+        for (size_t i = 0; i < N_BUCKETS; ++i) {
+          items.splice(items.end(), buckets_[i]);
+        }
+        std::fill_n(occupied_, N_WORDS, 0);
+        // items not yet swept expire after the last swept tick, in either resolution
+        last_tick_ = last_tick_ * resolution_.GetTimeStep() / resolution.GetTimeStep();
+        resolution_ = resolution;
+        size_ = 0;
+        while (!items.empty()) {
+          Container& item = items.front();
+          items.pop_front();
+          link(item);
+        }
+      }
+
+      inline const Time&
+      get_resolution() const
+      {
+        return resolution_;
+      }
+
+      /**
+       * @brief Get time at which an item expiring at @p expireTime will be removed by expire()
+       */
+      inline Time
+      get_expire_time(const Time& expireTime) const
+      {
+        return TimeStep(get_tick(expireTime) * resolution_.GetTimeStep());
+      }
+
+      /**
+       * @brief Get time at which expire() should be called next, or zero time if nothing expires
+       *
+       * The returned time is a lower bound: it is the end of the first non-empty tick, which
+       * may contain only items expiring in later revolutions of the wheel.
+       */
+      inline Time
+      get_next_expire_time() const
+      {
+        if (size_ == 0)
+          return Time();
+
+        int64_t tick = last_tick_ + 1;
+        tick += get_distance_to_occupied(get_bucket(tick));
+        return TimeStep(tick * resolution_.GetTimeStep());
+      }
+
+      /**
+       * @brief Remove items in all ticks ending no later than @p now
+       *
+       * Only non-empty buckets are visited, each at most once per call, regardless of the time
+       * since last call.
+       */
+      inline void
+      expire(const Time& now)
+      {
+        int64_t now_tick = now.GetTimeStep() / resolution_.GetTimeStep();
+        int64_t first_tick = std::max(last_tick_ + 1, now_tick - int64_t(N_BUCKETS) + 1);
+
+        for (int64_t tick = first_tick; size_ > 0; ++tick) {
+          tick += get_distance_to_occupied(get_bucket(tick));
+          if (tick > now_tick)
+            break;
+
+          policy_container& bucket = buckets_[get_bucket(tick)];
+          for (typename policy_container::iterator i = bucket.begin(); i != bucket.end();) {
+            Container& item = *i;
+            ++i; // erasing item unlinks it from the bucket
+            if (get_tick(get_freshness(&item)) <= now_tick) {
+              base_.erase(&item);
+            }
+          }
+        }
+        last_tick_ = std::max(last_tick_, now_tick);
+      }
+
     private:
+      inline int64_t
+      get_tick(const Time& time) const
+      {
+        // round up, so that items never expire before their time
+        int64_t step = resolution_.GetTimeStep();
+        return (time.GetTimeStep() + step - 1) / step;
+      }
+
+      static size_t
+      get_bucket(int64_t tick)
+      {
+        return static_cast<size_t>(tick) & (N_BUCKETS - 1);
+      }
+
+      /**
+       * @brief Get number of buckets from @p bucket to the first non-empty one, wrapping around
+       *        the wheel, or N_BUCKETS if all buckets are empty
+       */
+      inline size_t
+      get_distance_to_occupied(size_t bucket) const
+      {
+        size_t word = bucket / 64;
+        uint64_t bits = occupied_[word] >> (bucket % 64);
+        if (bits != 0)
+          return __builtin_ctzll(bits);
+
+        // the last word visited is the first one again, for buckets before @p bucket
+        size_t distance = 64 - bucket % 64;
+        for (size_t i = 1; i <= N_WORDS; ++i, distance += 64) {
+          bits = occupied_[(word + i) % N_WORDS];
+          if (bits != 0)
+            return distance + __builtin_ctzll(bits);
+        }
+        return N_BUCKETS;
+      }
+
+      inline void
+      link(Container& item)
+      {
+        size_t bucket = get_bucket(get_tick(get_freshness(&item)));
+        buckets_[bucket].push_back(item);
+        occupied_[bucket / 64] |= uint64_t(1) << (bucket % 64);
+        ++size_;
+      }
+
+      inline void
+      unlink(Container& item)
+      {
+        size_t bucket = get_bucket(get_tick(get_freshness(&item)));
+        buckets_[bucket].erase(buckets_[bucket].iterator_to(item));
+        if (buckets_[bucket].empty())
+          occupied_[bucket / 64] &= ~(uint64_t(1) << (bucket % 64));
+        --size_;
+      }
+
       type()
         : base_(*((Base*)0)){};
 
     private:
       Base& base_;
       size_t max_size_;
+      Time resolution_;
+      std::unique_ptr<policy_container[]> buckets_;
+      uint64_t occupied_[N_WORDS]; ///< @brief bit per bucket, set if the bucket is not empty
+      size_t size_;
+      int64_t last_tick_; ///< @brief last tick swept by expire()
     };
   };
 };
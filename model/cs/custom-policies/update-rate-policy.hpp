@@ -0,0 +1,272 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef UPDATE_RATE_POLICY_H_
+#define UPDATE_RATE_POLICY_H_
+
+/// @cond include_hidden
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <deque>
+#include <unordered_map>
+
+#include <ns3/random-variable-stream.h>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Traits for admission policy based on how often Data packets are updated
+ *
+ * Producers set DataTimestamp to the time of the last update of the content.  The policy
+ * remembers the last DataTimestamp seen for each name (also after the item leaves the cache)
+ * and estimates the update interval of the name as a moving average of differences between
+ * consecutive timestamps.  Names that have not been seen updating are always admitted.
+ * Names updating faster than the minimum update interval are admitted with probability
+ * interval / min_update_interval, so rapidly changing content neither churns the cache nor
+ * produces cache hits that need validation.
+ *
+ * The policy does not keep its own eviction order and should be placed after the cache
+ * replacement policy in multi_policy_traits, so that it is asked first and rejected items
+ * do not cause evictions.
+ */
+struct update_rate_policy_traits {
+  /// @brief Name that can be used to identify the policy (for NS-3 object model and logging)
+  static std::string
+  GetName()
+  {
+    return "UpdateRate";
+  }
+
+  struct policy_hook_type {
+  };
+
+  template<class Container>
+  struct container_hook {
+    struct type {
+    };
+  };
+
+  template<class Base, class Container, class Hook>
+  struct policy {
+    class type {
+    public:
+      typedef policy policy_base;
+      typedef Container parent_trie;
+
+      type(Base& base)
+        : base_(base)
+        , max_size_(100)
+        , min_update_interval_(0)
+        , max_history_size_(10000)
+        , n_admitted_(0)
+        , n_rejected_(0)
+        , n_updates_(0)
+        , ns3_rand_(CreateObject<UniformRandomVariable>())
+      {
+      }
+
+      inline void
+      update(typename parent_trie::iterator item)
+      {
+        // do nothing
+      }
+
+      inline bool
+      insert(typename parent_trie::iterator item)
+      {
+        const Data& data = *item->payload()->GetData();
+        double interval = observe(data.getName(), data.getDataTimestamp());
+
+        if (interval > 0 && interval < min_update_interval_ &&
+            ns3_rand_->GetValue() * min_update_interval_ >= interval) {
+          ++n_rejected_;
+          return false;
+        }
+
+        ++n_admitted_;
+        return true;
+      }
+
+      inline void
+      lookup(typename parent_trie::iterator item)
+      {
+        // do nothing
+      }
+
+      inline void
+      erase(typename parent_trie::iterator item)
+      {
+        // history is kept, so that the next version of the item can be judged
+      }
+
+      inline void
+      clear()
+      {
+      }
+
+      inline void
+      set_max_size(size_t max_size)
+      {
+        max_size_ = max_size;
+      }
+
+      inline size_t
+      get_max_size() const
+      {
+        return max_size_;
+      }
+
+      /**
+       * @brief Set update interval (in seconds) below which items are not always admitted
+       *        (0 means admit everything)
+       */
+      inline void
+      set_min_update_interval(double interval)
+      {
+        min_update_interval_ = interval;
+      }
+
+      inline double
+      get_min_update_interval() const
+      {
+        return min_update_interval_;
+      }
+
+      /**
+       * @brief Set maximum number of names for which update history is kept
+       */
+      inline void
+      set_max_history_size(size_t max_history_size)
+      {
+        max_history_size_ = max_history_size;
+        trim_history();
+      }
+
+      inline size_t
+      get_max_history_size() const
+      {
+        return max_history_size_;
+      }
+
+      /**
+       * @brief Get estimated update interval of the name (in seconds), 0 if not yet known
+       */
+      inline double
+      get_update_interval(const Name& name) const
+      {
+        auto it = history_.find(name);
+        return it != history_.end() ? it->second.interval : 0;
+      }
+
+      /// @brief Number of items admitted into the cache
+      inline uint64_t
+      get_n_admitted() const
+      {
+        return n_admitted_;
+      }
+
+      /// @brief Number of items not admitted because their content changes too often
+      inline uint64_t
+      get_n_rejected() const
+      {
+        return n_rejected_;
+      }
+
+      /// @brief Number of observed updates, i.e., items with a newer DataTimestamp than before
+      inline uint64_t
+      get_n_updates() const
+      {
+        return n_updates_;
+      }
+
+    private:
+      struct History {
+        int timestamp;
+        double interval;
+      };
+
+      /**
+       * @brief Record timestamp of the name and return its estimated update interval
+       */
+      double
+      observe(const Name& name, int timestamp)
+      {
+        auto result = history_.insert(std::make_pair(name, History{timestamp, 0}));
+        History& history = result.first->second;
+        if (result.second) {
+          order_.push_back(name);
+          trim_history();
+          return 0;
+        }
+
+        if (timestamp > history.timestamp) {
+          double sample = timestamp - history.timestamp;
+          if (history.interval == 0) {
+            history.interval = sample;
+          }
+          else {
+            history.interval = (1 - ALPHA) * history.interval + ALPHA * sample;
+          }
+          history.timestamp = timestamp;
+          ++n_updates_;
+        }
+        return history.interval;
+      }
+
+      void
+      trim_history()
+      {
+        while (history_.size() > max_history_size_ && !order_.empty()) {
+          history_.erase(order_.front());
+          order_.pop_front();
+        }
+      }
+
+      type()
+        : base_(*((Base*)0)){};
+
+    private:
+      static constexpr double ALPHA = 0.25; ///< weight of the newest interval sample
+
+      Base& base_;
+      size_t max_size_;
+      double min_update_interval_;
+      size_t max_history_size_;
+
+      std::unordered_map<Name, History> history_;
+      std::deque<Name> order_; ///< names in history_, oldest first
+
+      uint64_t n_admitted_;
+      uint64_t n_rejected_;
+      uint64_t n_updates_;
+      Ptr<UniformRandomVariable> ns3_rand_;
+    };
+  };
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // UPDATE_RATE_POLICY_H_
@@ -154,6 +154,12 @@ public:
   virtual uint32_t
   GetSize() const = 0;
 
+  /**
+   * @brief Get total size of Data packets in content store (in bytes of wire encoding)
+   */
+  virtual uint64_t
+  GetSizeInBytes() const = 0;
+
   /**
    * @brief Return first element of content store (no order guaranteed)
    */
@@ -211,10 +217,10 @@ ContentStore::GetContentStore(Ptr<Object> node)
 #include <boost/functional/hash.hpp>
 namespace boost {
 inline std::size_t
-hash_value(const ::ndn::name::Component component)
+hash_value(const ::ndn::name::Component& component)
 {
-  return boost::hash_range(component.wireEncode().wire(),
-                           component.wireEncode().wire() + component.wireEncode().size());
+  // same hash as cached by ::ndn::Name::getComponentHash
+  return std::hash<::ndn::name::Component>()(component);
 }
 }
 
@@ -19,12 +19,6 @@
 
 #include "ndn-header.hpp"
 
-#include <iosfwd>
-#include <boost/iostreams/concepts.hpp>
-#include <boost/iostreams/stream.hpp>
-
-namespace io = boost::iostreams;
-
 namespace ns3 {
 namespace ndn {
 
@@ -87,41 +81,54 @@ PacketHeader<Pkt>::Serialize(ns3::Buffer::Iterator start) const
   start.Write(m_packet->wireEncode().wire(), m_packet->wireEncode().size());
 }
 
-class Ns3BufferIteratorSource : public io::source {
-public:
-  Ns3BufferIteratorSource(ns3::Buffer::Iterator& is)
-    : m_is(is)
-  {
+/**
+ * @brief Read TLV-TYPE or TLV-LENGTH from @p i and append its bytes to @p header
+ */
+static uint64_t
+readVarNumber(ns3::Buffer::Iterator& i, uint8_t* header, size_t& headerSize)
+{
+  if (i.IsEnd()) {
+    throw ::ndn::tlv::Error("Insufficient data during TLV processing");
   }
 
-  std::streamsize
-  read(char* buf, std::streamsize nMaxRead)
-  {
-    std::streamsize i = 0;
-    for (; i < nMaxRead && !m_is.IsEnd(); ++i) {
-      buf[i] = m_is.ReadU8();
-    }
-    if (i == 0) {
-      return -1;
-    }
-    else {
-      return i;
-    }
+  uint8_t firstOctet = i.ReadU8();
+  header[headerSize++] = firstOctet;
+  if (firstOctet < 253) {
+    return firstOctet;
   }
 
-private:
-  ns3::Buffer::Iterator& m_is;
-};
+  size_t size = firstOctet == 253 ? 2 : (firstOctet == 254 ? 4 : 8);
+  uint64_t value = 0;
+  for (size_t octet = 0; octet < size; ++octet) {
+    if (i.IsEnd()) {
+      throw ::ndn::tlv::Error("Insufficient data during TLV processing");
+    }
+    uint8_t byte = i.ReadU8();
+    header[headerSize++] = byte;
+    value = (value << 8) | byte;
+  }
+  return value;
+}
 
 template<class Pkt>
 uint32_t
 PacketHeader<Pkt>::Deserialize(ns3::Buffer::Iterator start)
 {
-  auto packet = make_shared<Pkt>();
-  io::stream<Ns3BufferIteratorSource> is(start);
-  packet->wireDecode(::ndn::Block::fromStream(is));
-  m_packet = packet;
-  return packet->wireEncode().size();
+  // TLV-TYPE and TLV-LENGTH are read octet by octet, TLV-VALUE is copied in one step
+  uint8_t header[18];
+  size_t headerSize = 0;
+  readVarNumber(start, header, headerSize);
+  uint64_t length = readVarNumber(start, header, headerSize);
+  if (length > start.GetRemainingSize()) {
+    throw ::ndn::tlv::Error("Not enough data in the buffer to fully parse TLV");
+  }
+
+  auto buffer = make_shared<::ndn::Buffer>(headerSize + length);
+  std::copy(header, header + headerSize, buffer->begin());
+  start.Read(buffer->buf() + headerSize, length);
+
+  m_packet = make_shared<Pkt>(Block(buffer));
+  return buffer->size();
 }
 
 template<>
@@ -24,6 +24,7 @@
 #include "ns3/log.h"
 #include "ns3/callback.h"
 #include "ns3/uinteger.h"
+#include "ns3/boolean.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/object-vector.h"
 #include "ns3/pointer.h"
@@ -69,6 +70,13 @@ L3Protocol::GetTypeId(void)
       .SetParent<Object>()
       .AddConstructor<L3Protocol>()
 
+      .AddAttribute("DataPlaneOnly",
+                    "Create only the forwarder and its tables, without NFD management "
+                    "and RIB managers",
+                    BooleanValue(false),
+                    MakeBooleanAccessor(&L3Protocol::m_isDataPlaneOnly),
+                    MakeBooleanChecker())
+
       .AddTraceSource("OutInterests", "OutInterests",
                       MakeTraceSourceAccessor(&L3Protocol::m_outInterests),
                       "ns3::ndn::L3Protocol::InterestTraceCallback")
@@ -171,6 +179,7 @@ private:
 
 L3Protocol::L3Protocol()
   : m_impl(new Impl())
+  , m_isDataPlaneOnly(false)
 {
   NS_LOG_FUNCTION(this);
 }
@@ -185,8 +194,14 @@ L3Protocol::initialize()
 {
   m_impl->m_forwarder = make_shared<nfd::Forwarder>();
 
-  initializeManagement();
-  Simulator::ScheduleWithContext(m_node->GetId(), Seconds(0), &L3Protocol::initializeRibManager, this);
+  if (m_isDataPlaneOnly) {
+    initializeTables();
+  }
+  else {
+    initializeManagement();
+    Simulator::ScheduleWithContext(m_node->GetId(), Seconds(0),
+                                   &L3Protocol::initializeRibManager, this);
+  }
 
   m_impl->m_forwarder->getFaceTable().addReserved(make_shared<nfd::NullFace>(), nfd::FACEID_NULL);
 
@@ -266,6 +281,28 @@ L3Protocol::initializeManagement()
   entry->addNextHop(m_impl->m_internalFace, 0);
 }
 
+void
+L3Protocol::initializeTables()
+{
+  using namespace nfd;
+  auto& forwarder = m_impl->m_forwarder;
+
+  // only "tables" section is relevant without management
+  ConfigFile config((IgnoreSections({"general", "log", "authorizations", "face_system", "rib"})));
+
+  TablesConfigSection tablesConfig(forwarder->getCs(),
+                                   forwarder->getPit(),
+                                   forwarder->getFib(),
+                                   forwarder->getStrategyChoice(),
+                                   forwarder->getMeasurements());
+  tablesConfig.setConfigFile(config);
+
+  // apply config
+  config.parse(m_impl->m_config, false, "ndnSIM.conf");
+
+  tablesConfig.ensureTablesAreConfigured();
+}
+
 void
 L3Protocol::initializeRibManager()
 {
@@ -290,6 +327,29 @@ L3Protocol::initializeRibManager()
 
   m_impl->m_ribManager->setConfigFile(config);
 
+  // RIB and forwarder share the simulated node, so FIB updates computed by RIB are applied
+  // directly rather than as signed FIB management commands
+  Forwarder* forwarder = m_impl->m_forwarder.get();
+  m_impl->m_ribManager->setFibUpdateApplier([forwarder] (const rib::FibUpdate& update) {
+      shared_ptr<Face> face = forwarder->getFace(update.faceId);
+      if (update.action == rib::FibUpdate::ADD_NEXTHOP) {
+        if (face == nullptr) {
+          return false;
+        }
+        forwarder->getFib().insert(update.name).first->addNextHop(face, update.cost);
+      }
+      else if (face != nullptr) {
+        shared_ptr<fib::Entry> entry = forwarder->getFib().findExactMatch(update.name);
+        if (entry != nullptr) {
+          entry->removeNextHop(face);
+          if (!entry->hasNextHops()) {
+            forwarder->getFib().erase(*entry);
+          }
+        }
+      }
+      return true;
+    });
+
   // apply config
   config.parse(m_impl->m_config, false, "ndnSIM.conf");
 
@@ -304,6 +364,12 @@ L3Protocol::getForwarder()
   return m_impl->m_forwarder;
 }
 
+bool
+L3Protocol::isDataPlaneOnly() const
+{
+  return m_isDataPlaneOnly;
+}
+
 shared_ptr<nfd::FibManager>
 L3Protocol::getFibManager()
 {
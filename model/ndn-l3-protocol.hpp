@@ -99,6 +99,17 @@ public:
   shared_ptr<nfd::Forwarder>
   getForwarder();
 
+  /**
+   * \brief Check whether the stack has been created without NFD management and RIB managers
+   *
+   * Data-plane only stacks (DataPlaneOnly attribute) have only the forwarder and its tables:
+   * getFibManager() and getStrategyChoiceManager() return nullptr, and FibHelper and
+   * StrategyChoiceHelper update FIB and StrategyChoice tables directly.  Prefix registration
+   * through NFD management protocol (e.g., by ndn-cxx Face applications) is not available.
+   */
+  bool
+  isDataPlaneOnly() const;
+
   /**
    * \brief Get smart pointer to nfd::FibManager, used by node's NFD
    */
@@ -179,6 +190,9 @@ private:
   void
   initializeManagement();
 
+  void
+  initializeTables();
+
   void
   initializeRibManager();
 
@@ -189,6 +203,8 @@ private:
   // These objects are aggregated, but for optimization, get them here
   Ptr<Node> m_node; ///< \brief node on which ndn stack is installed
 
+  bool m_isDataPlaneOnly; ///< \brief whether management and RIB managers are not created
+
   TracedCallback<const Interest&, const Face&>
     m_inInterests; ///< @brief trace of incoming Interests
   TracedCallback<const Interest&, const Face&>
@@ -27,6 +27,7 @@
 #include "ns3/packet.h"
 #include "ns3/node.h"
 #include "ns3/pointer.h"
+#include "ns3/simulator.h"
 
 // #include "ns3/address.h"
 #include "ns3/point-to-point-net-device.h"
@@ -34,21 +35,53 @@
 
 #include "../utils/ndn-fw-hop-count-tag.hpp"
 
+#include <ndn-cxx/encoding/encoding-buffer.hpp>
+#include <ndn-cxx/encoding/tlv.hpp>
+
 NS_LOG_COMPONENT_DEFINE("ndn.NetDeviceFace");
 
 namespace ns3 {
 namespace ndn {
 
+const time::milliseconds NetDeviceFace::REASSEMBLY_TIMEOUT = time::milliseconds(500);
+
+/**
+ * @brief Create packet with the given content and packet tags (e.g., hop count) of another packet
+ */
+static Ptr<Packet>
+createPacketWithTags(Ptr<const Packet> tagsFrom, const uint8_t* buffer, uint32_t size)
+{
+  Ptr<Packet> packet = tagsFrom->Copy();
+  packet->RemoveAtEnd(packet->GetSize());
+  packet->AddAtEnd(Create<Packet>(buffer, size));
+  return packet;
+}
+
 NetDeviceFace::NetDeviceFace(Ptr<Node> node, const Ptr<NetDevice>& netDevice)
   : Face(FaceUri("netDeviceFace://"), FaceUri("netDeviceFace://"))
   , m_node(node)
   , m_netDevice(netDevice)
+  , m_aggregationWindow(0)
+  , m_aggregatedSize(0)
+  , m_nOutFrames(0)
+  , m_interestShapingRate(0)
+  , m_maxShapingQueue(100)
+  , m_nextInterestTime(0)
+  , m_expectedDataSize(0)
+  , m_nShapingDrops(0)
+  , m_nShapingExpirations(0)
 {
   NS_LOG_FUNCTION(this << netDevice);
 
   setMetric(1); // default metric
 
   NS_ASSERT_MSG(m_netDevice != 0, "NetDeviceFace needs to be assigned a valid NetDevice");
+  m_expectedDataSize = m_netDevice->GetMtu();
+
+  PointerValue txQueue;
+  if (m_netDevice->GetAttributeFailSafe("TxQueue", txQueue)) {
+    m_txQueue = txQueue.Get<Queue>();
+  }
 
   m_node->RegisterProtocolHandler(MakeCallback(&NetDeviceFace::receiveFromNetDevice, this),
                                   L3Protocol::ETHERNET_FRAME_TYPE, m_netDevice,
@@ -64,6 +97,16 @@ NetDeviceFace::~NetDeviceFace()
 void
 NetDeviceFace::close()
 {
+  // packets waiting for aggregation are dropped
+  Simulator::Cancel(m_aggregationEvent);
+  m_aggregatedPackets.clear();
+  m_aggregatedSize = 0;
+  m_reassemblers.clear();
+
+  // as well as Interests waiting for shaping
+  Simulator::Cancel(m_shapingEvent);
+  m_shapingQueue.clear();
+
   m_node->UnregisterProtocolHandler(MakeCallback(&NetDeviceFace::receiveFromNetDevice, this));
   this->fail("Close connection");
 }
@@ -75,29 +118,298 @@ NetDeviceFace::GetNetDevice() const
 }
 
 void
-NetDeviceFace::send(Ptr<Packet> packet)
+NetDeviceFace::setAggregationWindow(const Time& window)
 {
-  NS_ASSERT_MSG(packet->GetSize() <= m_netDevice->GetMtu(),
-                "Packet size " << packet->GetSize() << " exceeds device MTU "
-                               << m_netDevice->GetMtu());
+  if (window.IsZero()) {
+    sendAggregatedFrame();
+  }
+  m_aggregationWindow = window;
+}
+
+Time
+NetDeviceFace::getAggregationWindow() const
+{
+  return m_aggregationWindow;
+}
+
+uint64_t
+NetDeviceFace::getNOutFrames() const
+{
+  return m_nOutFrames;
+}
+
+void
+NetDeviceFace::setRateAveragingPeriod(const Time& period)
+{
+  m_inRate.setAveragingPeriod(period);
+  m_outRate.setAveragingPeriod(period);
+}
+
+Time
+NetDeviceFace::getRateAveragingPeriod() const
+{
+  return m_inRate.getAveragingPeriod();
+}
+
+double
+NetDeviceFace::getInRate() const
+{
+  return m_inRate.getRate(Simulator::Now());
+}
+
+double
+NetDeviceFace::getOutRate() const
+{
+  return m_outRate.getRate(Simulator::Now());
+}
+
+size_t
+NetDeviceFace::getQueueLength() const
+{
+  size_t length = m_aggregatedPackets.size() + m_shapingQueue.size();
+  if (m_txQueue != 0) {
+    length += m_txQueue->GetNPackets();
+  }
+  return length;
+}
+
+void
+NetDeviceFace::setInterestShapingRate(const DataRate& rate)
+{
+  m_interestShapingRate = rate;
+
+  if (m_interestShapingRate.GetBitRate() == 0) {
+    Simulator::Cancel(m_shapingEvent);
+    Time now = Simulator::Now();
+    while (!m_shapingQueue.empty()) {
+      dropExpiredShapedInterests(now);
+      if (!m_shapingQueue.empty()) {
+        sendInterestNow(*m_shapingQueue.front().interest);
+        m_shapingQueue.pop_front();
+      }
+    }
+  }
+}
 
+DataRate
+NetDeviceFace::getInterestShapingRate() const
+{
+  return m_interestShapingRate;
+}
+
+void
+NetDeviceFace::setMaxShapingQueue(size_t maxInterests)
+{
+  m_maxShapingQueue = maxInterests;
+}
+
+size_t
+NetDeviceFace::getMaxShapingQueue() const
+{
+  return m_maxShapingQueue;
+}
+
+double
+NetDeviceFace::getExpectedDataSize() const
+{
+  return m_expectedDataSize;
+}
+
+uint64_t
+NetDeviceFace::getNShapingDrops() const
+{
+  return m_nShapingDrops;
+}
+
+uint64_t
+NetDeviceFace::getNShapingExpirations() const
+{
+  return m_nShapingExpirations;
+}
+
+void
+NetDeviceFace::sendInterestNow(const Interest& interest)
+{
+  this->emitSignal(onSendInterest, interest);
+
+  Ptr<Packet> packet = Convert::ToPacket(interest);
+  send(packet);
+}
+
+void
+NetDeviceFace::dropExpiredShapedInterests(const Time& now)
+{
+  while (!m_shapingQueue.empty() && m_shapingQueue.front().expiry <= now) {
+    NS_LOG_DEBUG("Interest expired while waiting for shaping, dropping "
+                 << m_shapingQueue.front().interest->getName());
+    ++m_nShapingExpirations;
+    m_shapingQueue.pop_front();
+  }
+}
+
+void
+NetDeviceFace::sendShapedInterest()
+{
+  Time now = Simulator::Now();
+  dropExpiredShapedInterests(now);
+  if (m_shapingQueue.empty()) {
+    return;
+  }
+
+  if (now < m_nextInterestTime) {
+    m_shapingEvent = Simulator::Schedule(m_nextInterestTime - now,
+                                         &NetDeviceFace::sendShapedInterest, this);
+    return;
+  }
+
+  sendInterestNow(*m_shapingQueue.front().interest);
+  m_shapingQueue.pop_front();
+
+  Time interval = Seconds(m_expectedDataSize * 8 / m_interestShapingRate.GetBitRate());
+  m_nextInterestTime = now + interval;
+  if (!m_shapingQueue.empty()) {
+    m_shapingEvent = Simulator::Schedule(interval, &NetDeviceFace::sendShapedInterest, this);
+  }
+}
+
+void
+NetDeviceFace::send(Ptr<Packet> packet)
+{
   FwHopCountTag tag;
   packet->RemovePacketTag(tag);
   tag.Increment();
   packet->AddPacketTag(tag);
 
+  if (packet->GetSize() > m_netDevice->GetMtu()) {
+    sendFragments(packet);
+  }
+  else {
+    transmit(packet);
+  }
+}
+
+void
+NetDeviceFace::sendFragments(Ptr<Packet> packet)
+{
+  std::vector<uint8_t> buffer(packet->GetSize());
+  packet->CopyData(buffer.data(), buffer.size());
+
+  if (m_slicer == nullptr) {
+    m_slicer.reset(new nfd::ndnlp::Slicer(m_netDevice->GetMtu()));
+  }
+  nfd::ndnlp::PacketArray fragments = m_slicer->slice(Block(buffer.data(), buffer.size()));
+
+  NS_LOG_DEBUG("Sending " << packet->GetSize() << " bytes as " << fragments->size()
+               << " fragments");
+
+  for (const Block& fragment : *fragments) {
+    transmit(createPacketWithTags(packet, fragment.wire(), fragment.size()));
+  }
+}
+
+void
+NetDeviceFace::transmit(Ptr<Packet> packet)
+{
+  if (m_aggregationWindow.IsZero()) {
+    sendFrame(packet);
+    return;
+  }
+
+  uint32_t size = m_aggregatedSize + packet->GetSize();
+  if (1 + ::ndn::tlv::sizeOfVarNumber(size) + size > m_netDevice->GetMtu()) {
+    sendAggregatedFrame();
+  }
+
+  m_aggregatedPackets.push_back(packet);
+  m_aggregatedSize += packet->GetSize();
+
+  if (!m_aggregationEvent.IsRunning()) {
+    m_aggregationEvent = Simulator::Schedule(m_aggregationWindow,
+                                             &NetDeviceFace::sendAggregatedFrame, this);
+  }
+}
+
+void
+NetDeviceFace::sendFrame(Ptr<Packet> packet)
+{
+  NS_ASSERT_MSG(packet->GetSize() <= m_netDevice->GetMtu(),
+                "Packet size " << packet->GetSize() << " exceeds device MTU "
+                               << m_netDevice->GetMtu());
+
+  ++m_nOutFrames;
+  m_outRate.add(packet->GetSize(), Simulator::Now());
   m_netDevice->Send(packet, m_netDevice->GetBroadcast(), L3Protocol::ETHERNET_FRAME_TYPE);
 }
 
+void
+NetDeviceFace::sendAggregatedFrame()
+{
+  Simulator::Cancel(m_aggregationEvent);
+
+  if (m_aggregatedPackets.empty()) {
+    return;
+  }
+
+  if (m_aggregatedPackets.size() == 1) {
+    sendFrame(m_aggregatedPackets.front());
+  }
+  else {
+    NS_LOG_DEBUG("Aggregating " << m_aggregatedPackets.size() << " packets ("
+                 << m_aggregatedSize << " bytes) into one frame");
+
+    ::ndn::EncodingBuffer header(16, 16);
+    header.prependVarNumber(m_aggregatedSize);
+    header.prependVarNumber(AGGREGATE_FRAME_TYPE);
+
+    Ptr<Packet> frame = Create<Packet>(header.buf(), header.size());
+
+    // packet tags of individual packets are not carried over; the frame gets the largest
+    // hop count, which is restored on each packet when the frame is received
+    FwHopCountTag hopCount;
+    for (const Ptr<Packet>& packet : m_aggregatedPackets) {
+      FwHopCountTag tag;
+      if (packet->PeekPacketTag(tag) && tag.Get() > hopCount.Get()) {
+        hopCount = tag;
+      }
+      frame->AddAtEnd(packet);
+    }
+    frame->AddPacketTag(hopCount);
+
+    sendFrame(frame);
+  }
+
+  m_aggregatedPackets.clear();
+  m_aggregatedSize = 0;
+}
+
 void
 NetDeviceFace::sendInterest(const Interest& interest)
 {
   NS_LOG_FUNCTION(this << &interest);
 
-  this->emitSignal(onSendInterest, interest);
+  if (m_interestShapingRate.GetBitRate() == 0) {
+    sendInterestNow(interest);
+    return;
+  }
 
-  Ptr<Packet> packet = Convert::ToPacket(interest);
-  send(packet);
+  // expired Interests do not take space in the queue
+  Time now = Simulator::Now();
+  dropExpiredShapedInterests(now);
+
+  if (m_shapingQueue.size() >= m_maxShapingQueue) {
+    NS_LOG_DEBUG("Shaping queue is full, dropping " << interest.getName());
+    ++m_nShapingDrops;
+    return;
+  }
+
+  time::milliseconds lifetime = interest.getInterestLifetime();
+  if (lifetime < time::milliseconds::zero()) {
+    lifetime = ::ndn::DEFAULT_INTEREST_LIFETIME;
+  }
+  m_shapingQueue.push_back({interest.shared_from_this(), now + MilliSeconds(lifetime.count())});
+  if (!m_shapingEvent.IsRunning()) {
+    sendShapedInterest();
+  }
 }
 
 void
@@ -119,14 +431,37 @@ NetDeviceFace::receiveFromNetDevice(Ptr<NetDevice> device, Ptr<const Packet> p,
 {
   NS_LOG_FUNCTION(device << p << protocol << from << to << packetType);
 
+  m_inRate.add(p->GetSize(), Simulator::Now());
+
   Ptr<Packet> packet = p->Copy();
+
+  uint8_t type = 0;
+  if (packet->CopyData(&type, 1) == 1 && type == AGGREGATE_FRAME_TYPE) {
+    receiveAggregatedFrame(packet, from);
+  }
+  else {
+    receive(packet, from);
+  }
+}
+
+void
+NetDeviceFace::receive(Ptr<Packet> packet, const Address& from)
+{
+  uint8_t firstByte = 0;
+  if (packet->CopyData(&firstByte, 1) == 1 && firstByte == nfd::tlv::NdnlpData) {
+    receiveFragment(packet, from);
+    return;
+  }
+
   try {
-    uint32_t type = Convert::getPacketType(p);
+    uint32_t type = Convert::getPacketType(packet);
     if (type == ::ndn::tlv::Interest) {
       shared_ptr<const Interest> i = Convert::FromPacket<Interest>(packet);
       this->emitSignal(onReceiveInterest, *i);
     }
     else if (type == ::ndn::tlv::Data) {
+      m_expectedDataSize += (packet->GetSize() - m_expectedDataSize) / 8;
+
       shared_ptr<const Data> d = Convert::FromPacket<Data>(packet);
       this->emitSignal(onReceiveData, *d);
     }
@@ -139,5 +474,81 @@ NetDeviceFace::receiveFromNetDevice(Ptr<NetDevice> device, Ptr<const Packet> p,
   }
 }
 
+void
+NetDeviceFace::receiveAggregatedFrame(Ptr<Packet> frame, const Address& from)
+{
+  std::vector<uint8_t> buffer(frame->GetSize());
+  frame->CopyData(buffer.data(), buffer.size());
+
+  // find boundaries of all packets first, so that a malformed frame is dropped as a whole
+  std::vector<std::pair<uint32_t, uint32_t>> packets;
+  try {
+    const uint8_t* begin = buffer.data();
+    const uint8_t* end = buffer.data() + buffer.size();
+
+    ::ndn::tlv::readType(begin, end);
+    if (::ndn::tlv::readVarNumber(begin, end) != static_cast<uint64_t>(end - begin)) {
+      throw ::ndn::tlv::Error("Incorrect length of aggregated frame");
+    }
+
+    while (begin != end) {
+      const uint8_t* packetBegin = begin;
+      ::ndn::tlv::readType(begin, end);
+      uint64_t length = ::ndn::tlv::readVarNumber(begin, end);
+      if (length > static_cast<uint64_t>(end - begin)) {
+        throw ::ndn::tlv::Error("Incorrect length of aggregated packet");
+      }
+      begin += length;
+      packets.push_back(std::make_pair(packetBegin - buffer.data(), begin - packetBegin));
+    }
+  }
+  catch (::ndn::tlv::Error&) {
+    NS_LOG_ERROR("Malformed aggregated frame");
+    return;
+  }
+
+  // fragments keep packet tags of the frame, including its hop count
+  for (const auto& offsetAndSize : packets) {
+    receive(frame->CreateFragment(offsetAndSize.first, offsetAndSize.second), from);
+  }
+}
+
+void
+NetDeviceFace::receiveFragment(Ptr<Packet> packet, const Address& from)
+{
+  std::vector<uint8_t> buffer(packet->GetSize());
+  packet->CopyData(buffer.data(), buffer.size());
+
+  bool isOk = false;
+  Block block;
+  std::tie(isOk, block) = Block::fromBuffer(buffer.data(), buffer.size());
+  if (!isOk) {
+    NS_LOG_ERROR("Malformed NDNLP fragment");
+    return;
+  }
+
+  nfd::ndnlp::NdnlpData fragment;
+  std::tie(isOk, fragment) = nfd::ndnlp::NdnlpData::fromBlock(block);
+  if (!isOk) {
+    NS_LOG_ERROR("Invalid NDNLP fragment");
+    return;
+  }
+
+  std::unique_ptr<nfd::ndnlp::PartialMessageStore>& reassembler = m_reassemblers[from];
+  if (reassembler == nullptr) {
+    reassembler.reset(new nfd::ndnlp::PartialMessageStore(REASSEMBLY_TIMEOUT,
+                                                          MAX_PARTIAL_MESSAGES));
+    // the reassembled packet gets packet tags of its last fragment
+    reassembler->onReceive.connect([this, from] (const Block& reassembled) {
+        receive(createPacketWithTags(m_lastFragment, reassembled.wire(), reassembled.size()),
+                from);
+      });
+  }
+
+  m_lastFragment = packet;
+  reassembler->receive(fragment);
+  m_lastFragment = 0;
+}
+
 } // namespace ndn
 } // namespace ns3
@@ -22,8 +22,19 @@
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 #include "ns3/ndnSIM/model/ndn-face.hpp"
+#include "ns3/ndnSIM/NFD/daemon/face/ndnlp-slicer.hpp"
+#include "ns3/ndnSIM/NFD/daemon/face/ndnlp-partial-message-store.hpp"
+#include "ns3/ndnSIM/utils/ndn-rate-estimator.hpp"
 
 #include "ns3/net-device.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/queue.h"
+#include "ns3/data-rate.h"
+
+#include <deque>
+#include <map>
+#include <vector>
 
 namespace ns3 {
 namespace ndn {
@@ -40,6 +51,17 @@ namespace ndn {
  * object and this object cannot be changed for the lifetime of the
  * face
  *
+ * Packets larger than the device MTU are split into NDNLP fragments, which are reassembled
+ * by the receiving face.  Partial messages are kept per sender for up to REASSEMBLY_TIMEOUT
+ * after their last fragment, and at most MAX_PARTIAL_MESSAGES of them per sender.
+ *
+ * The face estimates its incoming and outgoing link rates, and reports the length of the
+ * transmit queue of its NetDevice (if the device has a "TxQueue" attribute, e.g.,
+ * PointToPointNetDevice), so that forwarding strategies can take load of the link into account.
+ *
+ * Optionally, outgoing Interests are paced so that Data returned for them fit into the capacity
+ * of the reverse direction of the link (see setInterestShapingRate).
+ *
  * \see NdnAppFace, NdnNetDeviceFace, NdnIpv4Face, NdnUdpFace
  */
 class NetDeviceFace : public Face {
@@ -65,6 +87,25 @@ public: // from nfd::Face
   virtual void
   close();
 
+  /**
+   * \brief Get estimated rate of frames received from the NetDevice, in bytes per second
+   */
+  virtual double
+  getInRate() const;
+
+  /**
+   * \brief Get estimated rate of frames passed to the NetDevice, in bytes per second
+   */
+  virtual double
+  getOutRate() const;
+
+  /**
+   * \brief Get number of packets in the transmit queue of the NetDevice, plus packets
+   *        waiting for aggregation and Interests waiting for shaping
+   */
+  virtual size_t
+  getQueueLength() const;
+
 public:
   /**
    * \brief Get NetDevice associated with the face
@@ -74,10 +115,142 @@ public:
   Ptr<NetDevice>
   GetNetDevice() const;
 
+  /**
+   * \brief Enable aggregation of outgoing packets into link frames
+   *
+   * Interests and Data sent within \p window after the first pending one are packed into a
+   * single link frame (TLV of AGGREGATE_FRAME_TYPE containing their wire encodings), as long as
+   * the frame fits into the device MTU.  A frame is sent earlier if the next packet would not
+   * fit into it, and a frame with a single packet is sent as a plain packet.  Aggregated
+   * frames are always accepted on receive, regardless of this setting.
+   *
+   * \param window aggregation window, zero (default) disables aggregation
+   */
+  void
+  setAggregationWindow(const Time& window);
+
+  Time
+  getAggregationWindow() const;
+
+  /**
+   * \brief Get number of link frames passed to the NetDevice
+   *
+   * Without aggregation, it equals the number of sent Interests and Data.
+   */
+  uint64_t
+  getNOutFrames() const;
+
+  /**
+   * \brief Set averaging period of in and out rate estimates (default 100ms)
+   *
+   * Shorter period makes the estimates follow changes of the load faster, but makes them
+   * noisier.
+   */
+  void
+  setRateAveragingPeriod(const Time& period);
+
+  Time
+  getRateAveragingPeriod() const;
+
+  /**
+   * \brief Enable pacing of outgoing Interests by the capacity of the reverse link
+   *
+   * Every Interest is expected to bring back a Data of getExpectedDataSize() bytes, so that
+   * Interests are sent at most one per getExpectedDataSize() / \p rate.  Interests that cannot
+   * be sent yet wait in a shaping queue; when it holds getMaxShapingQueue() Interests, new
+   * Interests are dropped.  Interests whose lifetime runs out while they wait are dropped too,
+   * instead of being sent.  Excess demand is thus shed as small Interests before they are
+   * forwarded, instead of as Data dropped from the transmit queue of the upstream.
+   *
+   * onSendInterest is emitted (and the outgoing Interest counter is incremented) when an
+   * Interest is actually passed to the NetDevice, not when it enters the shaping queue.
+   *
+   * \param rate data rate available to Data in the reverse direction of the link,
+   *             zero (default) disables shaping
+   */
+  void
+  setInterestShapingRate(const DataRate& rate);
+
+  DataRate
+  getInterestShapingRate() const;
+
+  /**
+   * \brief Set maximum number of Interests waiting for shaping (default 100)
+   */
+  void
+  setMaxShapingQueue(size_t maxInterests);
+
+  size_t
+  getMaxShapingQueue() const;
+
+  /**
+   * \brief Get expected size of Data received by the face, in bytes
+   *
+   * The expectation is a moving average of sizes of received Data (with weight 1/8 of the
+   * latest one).  Until the first Data is received, Data are assumed to be of the device MTU.
+   */
+  double
+  getExpectedDataSize() const;
+
+  /**
+   * \brief Get number of Interests dropped because the shaping queue was full
+   */
+  uint64_t
+  getNShapingDrops() const;
+
+  /**
+   * \brief Get number of Interests dropped because they expired in the shaping queue
+   */
+  uint64_t
+  getNShapingExpirations() const;
+
+public:
+  /// \brief TLV-TYPE of link frames carrying several Interest and Data packets
+  static const uint32_t AGGREGATE_FRAME_TYPE = 200;
+
+  /// \brief Time after the last received fragment when a partial message is dropped
+  static const time::milliseconds REASSEMBLY_TIMEOUT;
+
+  /// \brief Maximum number of partial messages per sender
+  static const size_t MAX_PARTIAL_MESSAGES = 64;
+
 private:
   void
   send(Ptr<Packet> packet);
 
+  void
+  sendFragments(Ptr<Packet> packet);
+
+  void
+  transmit(Ptr<Packet> packet);
+
+  void
+  sendFrame(Ptr<Packet> packet);
+
+  void
+  sendAggregatedFrame();
+
+  /// \brief emit onSendInterest and pass \p interest to the NetDevice
+  void
+  sendInterestNow(const Interest& interest);
+
+  /// \brief send the first unexpired Interest waiting for shaping, if its time has come
+  void
+  sendShapedInterest();
+
+  /// \brief drop expired Interests from the front of the shaping queue
+  void
+  dropExpiredShapedInterests(const Time& now);
+
+  void
+  receive(Ptr<Packet> packet, const Address& from);
+
+  void
+  receiveAggregatedFrame(Ptr<Packet> frame, const Address& from);
+
+  void
+  receiveFragment(Ptr<Packet> packet, const Address& from);
+
   /// \brief callback from lower layers
   void
   receiveFromNetDevice(Ptr<NetDevice> device, Ptr<const Packet> p, uint16_t protocol,
@@ -86,6 +259,37 @@ private:
 private:
   Ptr<Node> m_node;
   Ptr<NetDevice> m_netDevice; ///< \brief Smart pointer to NetDevice
+
+  Time m_aggregationWindow;
+  std::vector<Ptr<Packet>> m_aggregatedPackets;
+  uint32_t m_aggregatedSize; ///< \brief total size of m_aggregatedPackets
+  EventId m_aggregationEvent;
+
+  uint64_t m_nOutFrames;
+
+  RateEstimator m_inRate;
+  RateEstimator m_outRate;
+  Ptr<Queue> m_txQueue; ///< \brief transmit queue of the NetDevice, if any
+
+  /// \brief Interest waiting for shaping
+  struct ShapedInterest
+  {
+    shared_ptr<const Interest> interest;
+    Time expiry; ///< \brief time when the Interest lifetime runs out
+  };
+
+  DataRate m_interestShapingRate;
+  size_t m_maxShapingQueue;
+  std::deque<ShapedInterest> m_shapingQueue;
+  EventId m_shapingEvent;
+  Time m_nextInterestTime; ///< \brief earliest time when next Interest can be sent
+  double m_expectedDataSize;
+  uint64_t m_nShapingDrops;
+  uint64_t m_nShapingExpirations;
+
+  std::unique_ptr<nfd::ndnlp::Slicer> m_slicer; ///< \brief created on first oversized packet
+  std::map<Address, std::unique_ptr<nfd::ndnlp::PartialMessageStore>> m_reassemblers;
+  Ptr<Packet> m_lastFragment; ///< \brief fragment being passed to a reassembler
 };
 
 } // namespace ndn
@@ -33,10 +33,22 @@ template<class T>
 std::shared_ptr<const T>
 Convert::FromPacket(Ptr<Packet> packet)
 {
-  PacketHeader<T> header;
-  packet->RemoveHeader(header);
+  // Copy packet bytes once and decode the packet in place; going through PacketHeader would read
+  // the ns-3 buffer byte by byte into another buffer first
+  auto buffer = make_shared<::ndn::Buffer>(packet->GetSize());
+  packet->CopyData(buffer->buf(), buffer->size());
+
+  bool isOk = false;
+  Block block;
+  std::tie(isOk, block) = Block::fromBuffer(buffer, 0);
+  if (!isOk) {
+    throw ::ndn::tlv::Error("Malformed packet");
+  }
+
+  auto pkt = make_shared<T>(block);
 
-  auto pkt = header.getPacket();
+  // the rest of the packet keeps ns-3 packet tags (e.g., hop count)
+  packet->RemoveAtStart(block.size());
   pkt->setTag(make_shared<Ns3PacketTag>(packet));
 
   return pkt;
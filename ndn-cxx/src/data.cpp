@@ -21,6 +21,7 @@
 
 #include "data.hpp"
 #include "encoding/block-helpers.hpp"
+#include "encoding/block-view.hpp"
 #include "util/crypto.hpp"
 
 namespace ndn {
@@ -143,7 +144,6 @@ Data::wireDecode(const Block& wire)
 {
   m_fullName.clear();
   m_wire = wire;
-  m_wire.parse();
 
   // Data ::= DATA-TLV TLV-LENGTH
   //            Name
@@ -151,45 +151,49 @@ Data::wireDecode(const Block& wire)
   //            Content
   //            Signature
 
+  // sub-elements are located with a single pass over the wire; only the ones retained
+  // by the Data are turned into Blocks
+  BlockView view(m_wire);
+
   // Name
-  m_name.wireDecode(m_wire.get(tlv::Name));
+  m_name.wireDecode(view.toBlock(view.get(tlv::Name)));
 
   // MetaInfo
-  m_metaInfo.wireDecode(m_wire.get(tlv::MetaInfo));
+  m_metaInfo.wireDecode(view.toBlock(view.get(tlv::MetaInfo)));
 
   // Content
-  m_content = m_wire.get(tlv::Content);
+  m_content = view.toBlock(view.get(tlv::Content));
 
   ///////////////
   // Signature //
   ///////////////
 
   // SignatureInfo
-  m_signature.setInfo(m_wire.get(tlv::SignatureInfo));
+  m_signature.setInfo(view.toBlock(view.get(tlv::SignatureInfo)));
 
   // SignatureValue
-  Block::element_const_iterator val = m_wire.find(tlv::SignatureValue);
-  if (val != m_wire.elements_end())
-    m_signature.setValue(*val);
+  const BlockView::Element* val = view.find(tlv::SignatureValue);
+  if (val != nullptr)
+    m_signature.setValue(view.toBlock(*val));
 
-  val = m_wire.find(tlv::DataSignalFlag);
-  if (val != m_wire.elements_end()) {
+  val = view.find(tlv::DataSignalFlag);
+  if (val != nullptr) {
     DataSignalFlag = readNonNegativeInteger(*val);
   }
-  val = m_wire.find(tlv::DataTimestamp);
-  if (val != m_wire.elements_end()) {
+  val = view.find(tlv::DataTimestamp);
+  if (val != nullptr) {
     DataTimestamp = readNonNegativeInteger(*val);
   }
-  val = m_wire.find(tlv::DataExpiration);
-  if (val != m_wire.elements_end()) {
+  val = view.find(tlv::DataExpiration);
+  if (val != nullptr) {
     DataExpiration = readNonNegativeInteger(*val);
   }
-  val = m_wire.find(tlv::DataNodeIndex);
-  if (val != m_wire.elements_end()) {
+  val = view.find(tlv::DataNodeIndex);
+  if (val != nullptr) {
     DataNodeIndex = readNonNegativeInteger(*val);
   }
-  val = m_wire.find(tlv::DataPITList);
-  if (val != m_wire.elements_end()) {
+  val = view.find(tlv::DataPITList);
+  if (val != nullptr) {
     DataPITList = readString(*val);
   }
 }
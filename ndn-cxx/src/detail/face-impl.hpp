@@ -28,6 +28,7 @@
 #include "registered-prefix.hpp"
 #include "pending-interest.hpp"
 #include "container-with-on-empty-signal.hpp"
+#include "name-prefix-index.hpp"
 
 #include "../util/scheduler.hpp"
 #include "../util/config-file.hpp"
@@ -56,6 +57,17 @@ public:
   typedef std::list<shared_ptr<InterestFilterRecord> > InterestFilterTable;
   typedef ContainerWithOnEmptySignal<shared_ptr<RegisteredPrefix>> RegisteredPrefixTable;
 
+  /** \brief index of pending Interests by Interest name
+   *
+   *  Data can satisfy only Interests whose name is a prefix of the Data name, or equals
+   *  the Data full name, so only these entries are checked with Interest::matchesData
+   */
+  typedef NamePrefixIndex<PendingInterestTable::iterator> PendingInterestIndex;
+
+  /** \brief index of Interest filters by filter prefix
+   */
+  typedef NamePrefixIndex<shared_ptr<InterestFilterRecord>> InterestFilterIndex;
+
   class NfdFace : public ::nfd::LocalFace
   {
   public:
@@ -131,23 +143,26 @@ public:
   void
   satisfyPendingInterests(const Data& data)
   {
-    for (auto entry = m_pendingInterestTable.begin(); entry != m_pendingInterestTable.end(); ) {
-      if ((*entry)->getInterest().matchesData(data)) {
-        shared_ptr<PendingInterest> matchedEntry = *entry;
-
-        entry = m_pendingInterestTable.erase(entry);
+    auto candidates = m_pendingInterestIndex.findPrefixMatches(data.getName(),
+      [] (const name::Component& component) { return component.isImplicitSha256Digest(); });
 
-        matchedEntry->invokeDataCallback(data);
+    std::vector<shared_ptr<PendingInterest>> matchedEntries;
+    for (const auto& entry : candidates) {
+      if ((*entry)->getInterest().matchesData(data)) {
+        matchedEntries.push_back(*entry);
+        erasePendingInterest(entry);
       }
-      else
-        ++entry;
+    }
+
+    for (const auto& matchedEntry : matchedEntries) {
+      matchedEntry->invokeDataCallback(data);
     }
   }
 
   void
   processInterestFilters(const Interest& interest)
   {
-    for (const auto& filter : m_interestFilterTable) {
+    for (const auto& filter : m_interestFilterIndex.findPrefixMatches(interest.getName())) {
       if (filter->doesMatch(interest.getName())) {
         filter->invokeInterestCallback(interest);
       }
@@ -165,7 +180,8 @@ public:
       m_pendingInterestTable.insert(make_shared<PendingInterest>(interest,
                                                                  onData, onTimeout,
                                                                  ref(m_scheduler))).first;
-    (*entry)->setDeleter([this, entry] { m_pendingInterestTable.erase(entry); });
+    m_pendingInterestIndex.insert(interest->getName(), entry);
+    (*entry)->setDeleter([this, entry] { erasePendingInterest(entry); });
 
     m_nfdFace->emitSignal(onReceiveInterest, *interest);
   }
@@ -173,7 +189,25 @@ public:
   void
   asyncRemovePendingInterest(const PendingInterestId* pendingInterestId)
   {
-    m_pendingInterestTable.remove_if(MatchPendingInterestId(pendingInterestId));
+    auto entry = std::find_if(m_pendingInterestTable.begin(), m_pendingInterestTable.end(),
+                              MatchPendingInterestId(pendingInterestId));
+    if (entry != m_pendingInterestTable.end()) {
+      erasePendingInterest(entry);
+    }
+  }
+
+  void
+  erasePendingInterest(PendingInterestTable::iterator entry)
+  {
+    m_pendingInterestIndex.erase((*entry)->getInterest().getName(), entry);
+    m_pendingInterestTable.erase(entry);
+  }
+
+  void
+  clearPendingInterests()
+  {
+    m_pendingInterestIndex.clear();
+    m_pendingInterestTable.clear();
   }
 
   void
@@ -189,6 +223,8 @@ public:
   asyncSetInterestFilter(const shared_ptr<InterestFilterRecord>& interestFilterRecord)
   {
     m_interestFilterTable.push_back(interestFilterRecord);
+    m_interestFilterIndex.insert(interestFilterRecord->getFilter().getPrefix(),
+                                 interestFilterRecord);
   }
 
   void
@@ -199,6 +235,7 @@ public:
                                                    MatchInterestFilterId(interestFilterId));
     if (i != m_interestFilterTable.end())
       {
+        m_interestFilterIndex.erase((*i)->getFilter().getPrefix(), *i);
         m_interestFilterTable.erase(i);
       }
   }
@@ -239,7 +276,7 @@ public:
 
     if (static_cast<bool>(registeredPrefix->getFilter())) {
       // it was a combined operation
-      m_interestFilterTable.push_back(registeredPrefix->getFilter());
+      asyncSetInterestFilter(registeredPrefix->getFilter());
     }
 
     if (static_cast<bool>(onSuccess)) {
@@ -264,6 +301,7 @@ public:
       if (filter != nullptr) {
         // it was a combined operation
         m_interestFilterTable.remove(filter);
+        m_interestFilterIndex.erase(filter->getFilter().getPrefix(), filter);
       }
 
       ControlParameters params;
@@ -298,7 +336,9 @@ private:
   util::Scheduler m_scheduler;
 
   PendingInterestTable m_pendingInterestTable;
+  PendingInterestIndex m_pendingInterestIndex;
   InterestFilterTable m_interestFilterTable;
+  InterestFilterIndex m_interestFilterIndex;
   RegisteredPrefixTable m_registeredPrefixTable;
 
   shared_ptr<NfdFace> m_nfdFace;
@@ -0,0 +1,221 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_DETAIL_NAME_PREFIX_INDEX_HPP
+#define NDN_DETAIL_NAME_PREFIX_INDEX_HPP
+
+#include "../common.hpp"
+#include "../name.hpp"
+
+#include <unordered_map>
+#include <algorithm>
+
+namespace ndn {
+
+/**
+ * @brief Name trie that maps names to values and finds all values stored under
+ *        prefixes of a given name
+ *
+ * Each node keeps its children in a hash table keyed by the name component, so
+ * locating all prefixes of an N-component name takes N hash probes regardless of
+ * the number of stored values.  Lookups return values in the order they were
+ * inserted, which allows this index to be used in place of a linear scan over a
+ * list without changing the order in which matches are reported.
+ */
+template<class T>
+class NamePrefixIndex : noncopyable
+{
+public:
+  NamePrefixIndex()
+    : m_nextSeqNo(0)
+    , m_size(0)
+  {
+  }
+
+  /**
+   * @brief Store @p value under @p name
+   */
+  void
+  insert(const Name& name, const T& value)
+  {
+    Node* node = &m_root;
+    for (const name::Component& component : name) {
+      unique_ptr<Node>& child = node->children[component];
+      if (child == nullptr) {
+        child.reset(new Node(node));
+      }
+      node = child.get();
+    }
+    node->values.push_back(std::make_pair(m_nextSeqNo++, value));
+    ++m_size;
+  }
+
+  /**
+   * @brief Remove @p value previously stored under @p name
+   * @return true if the value was found and removed
+   */
+  bool
+  erase(const Name& name, const T& value)
+  {
+    Node* node = findNode(name);
+    if (node == nullptr)
+      return false;
+
+    auto item = std::find_if(node->values.begin(), node->values.end(),
+                             [&value] (const SeqValue& stored) { return stored.second == value; });
+    if (item == node->values.end())
+      return false;
+
+    node->values.erase(item);
+    --m_size;
+
+    // remove nodes that no longer lead to any value
+    for (size_t depth = name.size(); depth > 0; --depth) {
+      if (!node->values.empty() || !node->children.empty())
+        break;
+      Node* parent = node->parent;
+      parent->children.erase(name.get(depth - 1));
+      node = parent;
+    }
+    return true;
+  }
+
+  void
+  clear()
+  {
+    m_root.children.clear();
+    m_root.values.clear();
+    m_size = 0;
+  }
+
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  bool
+  empty() const
+  {
+    return m_size == 0;
+  }
+
+  /**
+   * @brief Find values stored under any prefix of @p name, including @p name itself
+   * @return matching values in insertion order
+   */
+  std::vector<T>
+  findPrefixMatches(const Name& name) const
+  {
+    return findPrefixMatches(name, [] (const name::Component&) { return false; });
+  }
+
+  /**
+   * @brief Find values stored under any prefix of @p name, including @p name itself,
+   *        and under names one component longer than @p name whose last component
+   *        satisfies @p acceptChild
+   * @return matching values in insertion order
+   */
+  template<class ChildPredicate>
+  std::vector<T>
+  findPrefixMatches(const Name& name, const ChildPredicate& acceptChild) const
+  {
+    std::vector<const SeqValue*> found;
+
+    const Node* node = &m_root;
+    collect(*node, found);
+    for (const name::Component& component : name) {
+      auto child = node->children.find(component);
+      if (child == node->children.end()) {
+        node = nullptr;
+        break;
+      }
+      node = child->second.get();
+      collect(*node, found);
+    }
+
+    if (node != nullptr) {
+      for (const auto& child : node->children) {
+        if (acceptChild(child.first)) {
+          collect(*child.second, found);
+        }
+      }
+    }
+
+    if (found.size() > 1) {
+      std::sort(found.begin(), found.end(),
+                [] (const SeqValue* a, const SeqValue* b) { return a->first < b->first; });
+    }
+
+    std::vector<T> values;
+    values.reserve(found.size());
+    for (const SeqValue* item : found) {
+      values.push_back(item->second);
+    }
+    return values;
+  }
+
+private:
+  typedef std::pair<uint64_t, T> SeqValue;
+
+  struct Node : noncopyable
+  {
+    explicit
+    Node(Node* parentNode = nullptr)
+      : parent(parentNode)
+    {
+    }
+
+    Node* parent;
+    std::unordered_map<name::Component, unique_ptr<Node>> children;
+    std::vector<SeqValue> values;
+  };
+
+  Node*
+  findNode(const Name& name)
+  {
+    Node* node = &m_root;
+    for (const name::Component& component : name) {
+      auto child = node->children.find(component);
+      if (child == node->children.end())
+        return nullptr;
+      node = child->second.get();
+    }
+    return node;
+  }
+
+  static void
+  collect(const Node& node, std::vector<const SeqValue*>& found)
+  {
+    for (const SeqValue& item : node.values) {
+      found.push_back(&item);
+    }
+  }
+
+private:
+  Node m_root;
+  uint64_t m_nextSeqNo;
+  size_t m_size;
+};
+
+} // namespace ndn
+
+#endif // NDN_DETAIL_NAME_PREFIX_INDEX_HPP
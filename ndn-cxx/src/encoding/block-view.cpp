@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "block-view.hpp"
+#include "tlv.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+namespace ndn {
+
+const size_t BlockView::INLINE_CAPACITY;
+
+BlockView::BlockView(const Block& block)
+  : m_block(block)
+  , m_size(0)
+{
+  if (!block.hasValue())
+    return;
+
+  Buffer::const_iterator begin = block.value_begin();
+  Buffer::const_iterator end = block.value_end();
+
+  while (begin != end) {
+    Buffer::const_iterator elementBegin = begin;
+
+    uint32_t type = tlv::readType(begin, end);
+    uint64_t length = tlv::readVarNumber(begin, end);
+
+    if (length > static_cast<uint64_t>(end - begin)) {
+      BOOST_THROW_EXCEPTION(tlv::Error("TLV length exceeds buffer length"));
+    }
+    Buffer::const_iterator elementEnd = begin + length;
+
+    append(type, elementBegin, elementEnd, begin, elementEnd);
+
+    begin = elementEnd;
+  }
+}
+
+void
+BlockView::append(uint32_t type,
+                  Buffer::const_iterator begin, Buffer::const_iterator end,
+                  Buffer::const_iterator valueBegin, Buffer::const_iterator valueEnd)
+{
+  Element* element = nullptr;
+  if (m_size < INLINE_CAPACITY) {
+    element = &m_inline[m_size];
+  }
+  else {
+    m_overflow.push_back(Element());
+    element = &m_overflow.back();
+  }
+
+  element->m_type = type;
+  element->m_begin = begin;
+  element->m_end = end;
+  element->m_valueBegin = valueBegin;
+  element->m_valueEnd = valueEnd;
+  ++m_size;
+}
+
+const BlockView::Element*
+BlockView::find(uint32_t type) const
+{
+  for (size_t i = 0; i < m_size; ++i) {
+    const Element& element = (*this)[i];
+    if (element.type() == type)
+      return &element;
+  }
+  return nullptr;
+}
+
+const BlockView::Element&
+BlockView::get(uint32_t type) const
+{
+  const Element* element = find(type);
+  if (element != nullptr)
+    return *element;
+
+  BOOST_THROW_EXCEPTION(Block::Error("(BlockView::get) Requested a non-existed type [" +
+                                     boost::lexical_cast<std::string>(type) + "] from Block"));
+}
+
+Block
+BlockView::toBlock(const Element& element) const
+{
+  return Block(m_block.getBuffer(), element.type(),
+               element.begin(), element.end(),
+               element.value_begin(), element.value_end());
+}
+
+uint64_t
+readNonNegativeInteger(const BlockView::Element& element)
+{
+  Buffer::const_iterator begin = element.value_begin();
+  return tlv::readNonNegativeInteger(element.value_size(), begin, element.value_end());
+}
+
+std::string
+readString(const BlockView::Element& element)
+{
+  return std::string(element.value_begin(), element.value_end());
+}
+
+} // namespace ndn
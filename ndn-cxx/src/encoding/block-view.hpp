@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_ENCODING_BLOCK_VIEW_HPP
+#define NDN_ENCODING_BLOCK_VIEW_HPP
+
+#include "../common.hpp"
+
+#include "block.hpp"
+
+namespace ndn {
+
+/**
+ * @brief Non-owning index of the top-level sub-elements of a Block
+ *
+ * Unlike Block::parse, which creates a full Block (with its own reference to the
+ * underlying buffer) for every sub-element, BlockView only records where each
+ * sub-element starts and ends.  Offsets are kept in a small inline array, so
+ * parsing typical Interest and Data packets does not allocate.  A Block for a
+ * sub-element is created only when it is explicitly requested with toBlock().
+ *
+ * The view references the wire of the parsed Block and must not outlive it.
+ */
+class BlockView : noncopyable
+{
+public:
+  class Element
+  {
+  public:
+    uint32_t
+    type() const
+    {
+      return m_type;
+    }
+
+    Buffer::const_iterator
+    begin() const
+    {
+      return m_begin;
+    }
+
+    Buffer::const_iterator
+    end() const
+    {
+      return m_end;
+    }
+
+    Buffer::const_iterator
+    value_begin() const
+    {
+      return m_valueBegin;
+    }
+
+    Buffer::const_iterator
+    value_end() const
+    {
+      return m_valueEnd;
+    }
+
+    size_t
+    value_size() const
+    {
+      return m_valueEnd - m_valueBegin;
+    }
+
+  private:
+    uint32_t m_type;
+    Buffer::const_iterator m_begin;
+    Buffer::const_iterator m_end;
+    Buffer::const_iterator m_valueBegin;
+    Buffer::const_iterator m_valueEnd;
+
+    friend class BlockView;
+  };
+
+  /**
+   * @brief Number of sub-elements stored without dynamic allocation
+   */
+  static const size_t INLINE_CAPACITY = 16;
+
+  /**
+   * @brief Index sub-elements of @p block
+   * @pre block.hasWire() is true
+   * @throw tlv::Error TLV-LENGTH of a sub-element exceeds the buffer
+   */
+  explicit
+  BlockView(const Block& block);
+
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  const Element&
+  operator[](size_t i) const
+  {
+    return i < INLINE_CAPACITY ? m_inline[i] : m_overflow[i - INLINE_CAPACITY];
+  }
+
+  /**
+   * @brief Find the first sub-element of type @p type
+   * @return pointer to the element, or nullptr if it does not exist
+   */
+  const Element*
+  find(uint32_t type) const;
+
+  /**
+   * @brief Get the first sub-element of type @p type
+   * @throw Block::Error sub-element does not exist
+   */
+  const Element&
+  get(uint32_t type) const;
+
+  /**
+   * @brief Create a Block for @p element that shares the buffer of the parsed Block
+   */
+  Block
+  toBlock(const Element& element) const;
+
+private:
+  void
+  append(uint32_t type,
+         Buffer::const_iterator begin, Buffer::const_iterator end,
+         Buffer::const_iterator valueBegin, Buffer::const_iterator valueEnd);
+
+private:
+  const Block& m_block;
+  size_t m_size;
+  Element m_inline[INLINE_CAPACITY];
+  std::vector<Element> m_overflow;
+};
+
+/**
+ * @brief Helper to read a non-negative integer from a sub-element in a BlockView
+ * @throw tlv::Error if block does not contain a valid nonNegativeInteger
+ */
+uint64_t
+readNonNegativeInteger(const BlockView::Element& element);
+
+/**
+ * @brief Helper to read a string from a sub-element in a BlockView
+ */
+std::string
+readString(const BlockView::Element& element);
+
+} // namespace ndn
+
+#endif // NDN_ENCODING_BLOCK_VIEW_HPP
@@ -313,7 +313,7 @@ void
 Face::shutdown()
 {
   m_impl->m_scheduler.scheduleEvent(time::seconds(0), [=] {
-      m_impl->m_pendingInterestTable.clear();
+      m_impl->clearPendingInterests();
       m_impl->m_registeredPrefixTable.clear();
 
       m_impl->m_nfdFace->close();
@@ -23,6 +23,7 @@
 #include "util/random.hpp"
 #include "util/crypto.hpp"
 #include "data.hpp"
+#include "encoding/block-view.hpp"
 
 namespace ndn {
 
@@ -303,7 +304,6 @@ void
 Interest::wireDecode(const Block& wire)
 {
   m_wire = wire;
-  m_wire.parse();
 
   // Interest ::= INTEREST-TYPE TLV-LENGTH
   //                Name
@@ -316,24 +316,28 @@ Interest::wireDecode(const Block& wire)
   if (m_wire.type() != tlv::Interest)
     BOOST_THROW_EXCEPTION(Error("Unexpected TLV number when decoding Interest"));
 
+  // sub-elements are located with a single pass over the wire; only the ones retained
+  // by the Interest are turned into Blocks
+  BlockView view(m_wire);
+
   // Name
-  m_name.wireDecode(m_wire.get(tlv::Name));
+  m_name.wireDecode(view.toBlock(view.get(tlv::Name)));
 
   // Selectors
-  Block::element_const_iterator val = m_wire.find(tlv::Selectors);
-  if (val != m_wire.elements_end())
+  const BlockView::Element* val = view.find(tlv::Selectors);
+  if (val != nullptr)
     {
-      m_selectors.wireDecode(*val);
+      m_selectors.wireDecode(view.toBlock(*val));
     }
   else
     m_selectors = Selectors();
 
   // Nonce
-  m_nonce = m_wire.get(tlv::Nonce);
+  m_nonce = view.toBlock(view.get(tlv::Nonce));
 
   // InterestLifetime
-  val = m_wire.find(tlv::InterestLifetime);
-  if (val != m_wire.elements_end())
+  val = view.find(tlv::InterestLifetime);
+  if (val != nullptr)
     {
       m_interestLifetime = time::milliseconds(readNonNegativeInteger(*val));
     }
@@ -343,15 +347,15 @@ Interest::wireDecode(const Block& wire)
     }
 
   // Link object
-  val = m_wire.find(tlv::Data);
-  if (val != m_wire.elements_end())
+  val = view.find(tlv::Data);
+  if (val != nullptr)
     {
-      m_link = (*val);
+      m_link = view.toBlock(*val);
     }
 
   // SelectedDelegation
-  val = m_wire.find(tlv::SelectedDelegation);
-  if (val != m_wire.elements_end()) {
+  val = view.find(tlv::SelectedDelegation);
+  if (val != nullptr) {
     if (!this->hasLink()) {
       BOOST_THROW_EXCEPTION(Error("Interest contains selectedDelegation, but no LINK object"));
     }
@@ -364,27 +368,27 @@ Interest::wireDecode(const Block& wire)
     }
   }
 
-  val = m_wire.find(tlv::InterestPITList);
-  if (val != m_wire.elements_end()) {
+  val = view.find(tlv::InterestPITList);
+  if (val != nullptr) {
     InterestPITList = readString(*val);
   }
 
-  val = m_wire.find(tlv::InterestSignalFlag);
-  if (val != m_wire.elements_end()) {
+  val = view.find(tlv::InterestSignalFlag);
+  if (val != nullptr) {
     InterestSignalFlag = readNonNegativeInteger(*val);
   }
 
-  val = m_wire.find(tlv::InterestNodeIndex);
-  if (val != m_wire.elements_end()) {
+  val = view.find(tlv::InterestNodeIndex);
+  if (val != nullptr) {
     InterestNodeIndex = readNonNegativeInteger(*val);
   }
 
-  val = m_wire.find(tlv::InterestEntryIndex);
-  if (val != m_wire.elements_end()) {
+  val = view.find(tlv::InterestEntryIndex);
+  if (val != nullptr) {
     InterestEntryIndex = readNonNegativeInteger(*val);
   }
-  val = m_wire.find(tlv::InterestTimestamp);
-  if (val != m_wire.elements_end()) {
+  val = view.find(tlv::InterestTimestamp);
+  if (val != nullptr) {
     InterestTimestamp = readNonNegativeInteger(*val);
   }
 }
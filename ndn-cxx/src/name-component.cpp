@@ -30,8 +30,10 @@
 #include "util/string-helper.hpp"
 #include "security/cryptopp.hpp"
 #include "util/crypto.hpp"
+#include "util/simd.hpp"
 
 #include <boost/lexical_cast.hpp>
+#include <boost/functional/hash.hpp>
 
 namespace ndn {
 namespace name {
@@ -475,3 +477,29 @@ Component::wireDecode(const Block& wire)
 
 } // namespace name
 } // namespace ndn
+
+namespace std {
+size_t
+hash<ndn::name::Component>::operator()(const ndn::name::Component& component) const
+{
+  // CRC-32C of TLV-VALUE is computed with the crc32 instruction when available, and gives
+  // the same value on every platform
+  size_t hash = 0;
+  if (component.value_size() > 0) {
+    hash = ndn::util::simd::crc32c(0xFFFFFFFF, component.value(), component.value_size()) ^
+           0xFFFFFFFF;
+  }
+
+  // consistent with Component::equals, which compares TLV-TYPE and TLV-VALUE
+  boost::hash_combine(hash, component.value_size());
+  boost::hash_combine(hash, component.type());
+
+  // spread the 32-bit CRC over all 64 bits (finalizer of MurmurHash3)
+  uint64_t mixed = hash;
+  mixed ^= mixed >> 33;
+  mixed *= 0xff51afd7ed558ccdULL;
+  mixed ^= mixed >> 33;
+  return static_cast<size_t>(mixed);
+}
+
+} // namespace std
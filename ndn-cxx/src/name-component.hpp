@@ -509,6 +509,9 @@ public:
   bool
   equals(const Component& other) const
   {
+    // consistent with compare(), components of different types are different
+    if (type() != other.type())
+      return false;
     if (value_size() != other.value_size())
       return false;
     if (value_size() == 0 /* == other.value_size()*/)
@@ -626,4 +629,14 @@ Component::Component(Iterator first, Iterator last)
 } // namespace name
 } // namespace ndn
 
+namespace std {
+template<>
+struct hash<ndn::name::Component>
+{
+  size_t
+  operator()(const ndn::name::Component& component) const;
+};
+
+} // namespace std
+
 #endif // NDN_NAME_COMPONENT_HPP
@@ -29,6 +29,7 @@
 #include "util/string-helper.hpp"
 #include "encoding/block.hpp"
 #include "encoding/encoding-buffer.hpp"
+#include "util/simd.hpp"
 
 #include <boost/functional/hash.hpp>
 
@@ -112,6 +113,7 @@ Name::wireDecode(const Block& wire)
 
   m_nameBlock = wire;
   m_nameBlock.parse();
+  m_hashes.reset();
 }
 
 void
@@ -204,6 +206,7 @@ Name&
 Name::appendNumber(uint64_t number)
 {
   m_nameBlock.push_back(Component::fromNumber(number));
+  m_hashes.reset();
   return *this;
 }
 
@@ -211,6 +214,7 @@ Name&
 Name::appendNumberWithMarker(uint8_t marker, uint64_t number)
 {
   m_nameBlock.push_back(Component::fromNumberWithMarker(marker, number));
+  m_hashes.reset();
   return *this;
 }
 
@@ -218,6 +222,7 @@ Name&
 Name::appendVersion(uint64_t version)
 {
   m_nameBlock.push_back(Component::fromVersion(version));
+  m_hashes.reset();
   return *this;
 }
 
@@ -232,6 +237,7 @@ Name&
 Name::appendSegment(uint64_t segmentNo)
 {
   m_nameBlock.push_back(Component::fromSegment(segmentNo));
+  m_hashes.reset();
   return *this;
 }
 
@@ -239,6 +245,7 @@ Name&
 Name::appendSegmentOffset(uint64_t offset)
 {
   m_nameBlock.push_back(Component::fromSegmentOffset(offset));
+  m_hashes.reset();
   return *this;
 }
 
@@ -246,6 +253,7 @@ Name&
 Name::appendTimestamp(const time::system_clock::TimePoint& timePoint)
 {
   m_nameBlock.push_back(Component::fromTimestamp(timePoint));
+  m_hashes.reset();
   return *this;
 }
 
@@ -253,6 +261,7 @@ Name&
 Name::appendSequenceNumber(uint64_t seqNo)
 {
   m_nameBlock.push_back(Component::fromSequenceNumber(seqNo));
+  m_hashes.reset();
   return *this;
 }
 
@@ -260,6 +269,7 @@ Name&
 Name::appendImplicitSha256Digest(const ConstBufferPtr& digest)
 {
   m_nameBlock.push_back(Component::fromImplicitSha256Digest(digest));
+  m_hashes.reset();
   return *this;
 }
 
@@ -267,9 +277,35 @@ Name&
 Name::appendImplicitSha256Digest(const uint8_t* digest, size_t digestSize)
 {
   m_nameBlock.push_back(Component::fromImplicitSha256Digest(digest, digestSize));
+  m_hashes.reset();
   return *this;
 }
 
+shared_ptr<const Name::Hashes>
+Name::computeHashes() const
+{
+  auto hashes = make_shared<Hashes>();
+  hashes->components.reserve(size());
+  hashes->prefixes.reserve(size() + 1);
+
+  std::hash<Component> hashComponent;
+  size_t prefixHash = 0;
+  hashes->prefixes.push_back(prefixHash);
+  for (const Component& component : *this) {
+    size_t componentHash = hashComponent(component);
+    boost::hash_combine(prefixHash, componentHash);
+    hashes->components.push_back(componentHash);
+    hashes->prefixes.push_back(prefixHash);
+  }
+
+  shared_ptr<const Hashes> stored;
+  if (!std::atomic_compare_exchange_strong(&m_hashes, &stored,
+                                           shared_ptr<const Hashes>(hashes))) {
+    return stored;
+  }
+  return hashes;
+}
+
 PartialName
 Name::getSubName(ssize_t iStartComponent, size_t nComponents) const
 {
@@ -308,8 +344,17 @@ Name::equals(const Name& name) const
   if (size() != name.size())
     return false;
 
-  for (size_t i = 0; i < size(); ++i) {
-    if (at(i) != name.at(i))
+  shared_ptr<const Hashes> hashes = std::atomic_load(&m_hashes);
+  shared_ptr<const Hashes> otherHashes = std::atomic_load(&name.m_hashes);
+  if (hashes != nullptr && otherHashes != nullptr &&
+      hashes->prefixes.back() != otherHashes->prefixes.back())
+    return false;
+
+  // names being compared usually share a prefix, so the remaining components are
+  // checked starting from the last one
+  size_t nIdentical = countIdenticalComponents(name);
+  for (size_t i = size(); i > nIdentical; --i) {
+    if (get(i - 1) != name.get(i - 1))
       return false;
   }
 
@@ -323,9 +368,16 @@ Name::isPrefixOf(const Name& name) const
   if (size() > name.size())
     return false;
 
+  shared_ptr<const Hashes> hashes = std::atomic_load(&m_hashes);
+  shared_ptr<const Hashes> otherHashes = std::atomic_load(&name.m_hashes);
+  if (hashes != nullptr && otherHashes != nullptr &&
+      hashes->prefixes.back() != otherHashes->prefixes[size()])
+    return false;
+
   // Check if at least one of given components doesn't match.
-  for (size_t i = 0; i < size(); ++i) {
-    if (at(i) != name.at(i))
+  size_t nIdentical = countIdenticalComponents(name);
+  for (size_t i = size(); i > nIdentical; --i) {
+    if (get(i - 1) != name.get(i - 1))
       return false;
   }
 
@@ -339,8 +391,13 @@ Name::compare(size_t pos1, size_t count1, const Name& other, size_t pos2, size_t
   count2 = std::min(count2, other.size() - pos2);
   size_t count = std::min(count1, count2);
 
-  for (size_t i = 0; i < count; ++i) {
-    int comp = this->at(pos1 + i).compare(other.at(pos2 + i));
+  size_t i = 0;
+  if (pos1 == 0 && pos2 == 0) {
+    i = std::min(count, countIdenticalComponents(other));
+  }
+
+  for (; i < count; ++i) {
+    int comp = this->get(pos1 + i).compare(other.get(pos2 + i));
     if (comp != 0) { // i-th component differs
       return comp;
     }
@@ -349,6 +406,27 @@ Name::compare(size_t pos1, size_t count1, const Name& other, size_t pos2, size_t
   return count1 - count2;
 }
 
+size_t
+Name::countIdenticalComponents(const Name& other) const
+{
+  if (!m_nameBlock.hasWire() || !other.m_nameBlock.hasWire())
+    return 0;
+
+  size_t mismatch = util::simd::findFirstMismatch(m_nameBlock.value(), other.m_nameBlock.value(),
+                                                  std::min(m_nameBlock.value_size(),
+                                                           other.m_nameBlock.value_size()));
+
+  // elements of a Name with wire encoding are parsed from that wire, in order
+  Buffer::const_iterator valueBegin = m_nameBlock.value_begin();
+  const Block::element_container& elements = m_nameBlock.elements();
+  Block::element_const_iterator firstDifferent =
+    std::partition_point(elements.begin(), elements.end(),
+                         [valueBegin, mismatch] (const Block& element) {
+                           return static_cast<size_t>(element.end() - valueBegin) <= mismatch;
+                         });
+  return firstDifferent - elements.begin();
+}
+
 std::ostream&
 operator<<(std::ostream& os, const Name& name)
 {
@@ -382,8 +460,7 @@ namespace std {
 size_t
 hash<ndn::Name>::operator()(const ndn::Name& name) const
 {
-  return boost::hash_range(name.wireEncode().wire(),
-                           name.wireEncode().wire() + name.wireEncode().size());
+  return name.getPrefixHash(name.size());
 }
 
 } // namespace std
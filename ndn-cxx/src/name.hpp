@@ -148,6 +148,7 @@ public:
   append(const uint8_t* value, size_t valueLength)
   {
     m_nameBlock.push_back(Component(value, valueLength));
+    m_hashes.reset();
     return *this;
   }
 
@@ -165,6 +166,7 @@ public:
   append(Iterator first, Iterator last)
   {
     m_nameBlock.push_back(Component(first, last));
+    m_hashes.reset();
     return *this;
   }
 
@@ -175,6 +177,7 @@ public:
   append(const Component& value)
   {
     m_nameBlock.push_back(value);
+    m_hashes.reset();
     return *this;
   }
 
@@ -189,6 +192,7 @@ public:
   append(const char* value)
   {
     m_nameBlock.push_back(Component(value));
+    m_hashes.reset();
     return *this;
   }
 
@@ -200,6 +204,7 @@ public:
     else
       m_nameBlock.push_back(Block(tlv::NameComponent, value));
 
+    m_hashes.reset();
     return *this;
   }
 
@@ -218,6 +223,7 @@ public:
   clear()
   {
     m_nameBlock = Block(tlv::Name);
+    m_hashes.reset();
   }
 
   /**
@@ -410,6 +416,45 @@ public:
     return m_nameBlock.elements_size();
   }
 
+  /**
+   * @brief Get hash of the component at index @p i
+   *
+   * Hashes of all components and all prefixes of the name are computed together on
+   * first use and kept with the Name until it is modified, so tables that look up
+   * the same Name several times (e.g. NameTree, DeadNonceList and the content store
+   * on every hop) hash it only once.
+   *
+   * @pre i < size()
+   * @return same value as std::hash<name::Component>()(get(i))
+   */
+  size_t
+  getComponentHash(size_t i) const
+  {
+    return getHashes().components[i];
+  }
+
+  /**
+   * @brief Get hash of the prefix with the first @p nComponents components
+   * @pre nComponents <= size()
+   * @return 0 for the empty prefix; getPrefixHash(size()) equals std::hash<Name>()(*this)
+   * @sa getComponentHash
+   */
+  size_t
+  getPrefixHash(size_t nComponents) const
+  {
+    return getHashes().prefixes[nComponents];
+  }
+
+  /**
+   * @brief Get hashes of all prefixes of the name, from the empty prefix to the name itself
+   * @sa getPrefixHash
+   */
+  const std::vector<size_t>&
+  getPrefixHashes() const
+  {
+    return getHashes().prefixes;
+  }
+
   /**
    * Get the component at the given index.
    * @param i The index of the component, starting from 0.
@@ -611,6 +656,48 @@ private:
   void
   construct(const char* uri);
 
+  /// component and prefix hashes, shared among copies of the same Name
+  struct Hashes
+  {
+    std::vector<size_t> components;
+    std::vector<size_t> prefixes;
+  };
+
+  /**
+   * @brief Get cached hashes, computing them on first use
+   *
+   * The cache is accessed atomically, so that const methods that use hashes can be called
+   * on the same Name from several threads: threads that find the cache empty may compute
+   * the hashes concurrently, but only the first result is stored and all of them use it.
+   * As with other lazily initialized state of Name (e.g. its wire encoding), copying or
+   * modifying a Name while another thread uses it is not safe.
+   */
+  const Hashes&
+  getHashes() const
+  {
+    shared_ptr<const Hashes> hashes = std::atomic_load(&m_hashes);
+    if (hashes == nullptr)
+      hashes = computeHashes();
+    // the instance is owned by m_hashes, which is not replaced until the Name is modified
+    return *hashes;
+  }
+
+  /**
+   * @return hashes stored in m_hashes, which are computed by this or by another thread
+   */
+  shared_ptr<const Hashes>
+  computeHashes() const;
+
+  /**
+   * @brief Count leading components whose encoding is identical in this and @p other name
+   *
+   * Both wire encodings are compared as a whole, which is faster than comparing
+   * component by component.
+   * @return 0 if either name does not have wire encoding
+   */
+  size_t
+  countIdenticalComponents(const Name& other) const;
+
 public:
   /** \brief indicates "until the end" in getSubName and compare
    */
@@ -618,6 +705,7 @@ public:
 
 private:
   mutable Block m_nameBlock;
+  mutable shared_ptr<const Hashes> m_hashes;
 };
 
 std::ostream&
@@ -0,0 +1,235 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "simd.hpp"
+
+#include <cstring>
+#include <ostream>
+
+// Vector kernels are compiled with per-function target attributes and selected at runtime,
+// so no special compiler flags are needed
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#  define NDN_CXX_SIMD_X86 1
+#  include <immintrin.h>
+#else
+#  define NDN_CXX_SIMD_X86 0
+#endif
+
+namespace ndn {
+namespace util {
+namespace simd {
+
+std::ostream&
+operator<<(std::ostream& os, Level level)
+{
+  switch (level) {
+  case Level::SCALAR:
+    return os << "scalar";
+  case Level::SSE42:
+    return os << "sse4.2";
+  case Level::AVX2:
+    return os << "avx2";
+  }
+  return os << static_cast<int>(level);
+}
+
+// scalar kernels
+
+static const uint32_t CRC32C_POLYNOMIAL = 0x82F63B78; // reflected
+
+struct Crc32cTable
+{
+  Crc32cTable()
+  {
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t crc = i;
+      for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc >> 1) ^ (CRC32C_POLYNOMIAL & (0 - (crc & 1)));
+      }
+      entries[i] = crc;
+    }
+  }
+
+  uint32_t entries[256];
+};
+
+static uint32_t
+crc32cScalar(uint32_t crc, const uint8_t* data, size_t size)
+{
+  static const Crc32cTable table;
+  for (; size > 0; --size, ++data) {
+    crc = table.entries[(crc ^ *data) & 0xFF] ^ (crc >> 8);
+  }
+  return crc;
+}
+
+static size_t
+findFirstMismatchScalar(const uint8_t* first, const uint8_t* second, size_t size)
+{
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t a, b;
+    std::memcpy(&a, first + i, sizeof(a));
+    std::memcpy(&b, second + i, sizeof(b));
+    if (a != b)
+      break;
+  }
+  for (; i < size; ++i) {
+    if (first[i] != second[i])
+      break;
+  }
+  return i;
+}
+
+#if NDN_CXX_SIMD_X86
+
+__attribute__((target("sse4.2")))
+static uint32_t
+crc32cSse42(uint32_t crc, const uint8_t* data, size_t size)
+{
+  uint64_t crc64 = crc;
+  for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), data += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    crc64 = _mm_crc32_u64(crc64, word);
+  }
+
+  uint32_t crc32 = static_cast<uint32_t>(crc64);
+  for (; size > 0; --size, ++data) {
+    crc32 = _mm_crc32_u8(crc32, *data);
+  }
+  return crc32;
+}
+
+__attribute__((target("sse4.2")))
+static size_t
+findFirstMismatchSse42(const uint8_t* first, const uint8_t* second, size_t size)
+{
+  size_t i = 0;
+  for (; i + sizeof(__m128i) <= size; i += sizeof(__m128i)) {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(second + i));
+    uint32_t differs = ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))) & 0xFFFF;
+    if (differs != 0)
+      return i + __builtin_ctz(differs);
+  }
+  return i + findFirstMismatchScalar(first + i, second + i, size - i);
+}
+
+__attribute__((target("avx2")))
+static size_t
+findFirstMismatchAvx2(const uint8_t* first, const uint8_t* second, size_t size)
+{
+  size_t i = 0;
+  for (; i + sizeof(__m256i) <= size; i += sizeof(__m256i)) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(second + i));
+    uint32_t differs = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+    if (differs != 0)
+      return i + __builtin_ctz(differs);
+  }
+  // avoid AVX-SSE transition penalty in the SSE code
+  _mm256_zeroupper();
+  return i + findFirstMismatchSse42(first + i, second + i, size - i);
+}
+
+#endif // NDN_CXX_SIMD_X86
+
+// dispatch
+
+struct Kernels
+{
+  Level level;
+  uint32_t (*crc32c)(uint32_t, const uint8_t*, size_t);
+  size_t (*findFirstMismatch)(const uint8_t*, const uint8_t*, size_t);
+};
+
+static Level
+detectLevel()
+{
+#if NDN_CXX_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse4.2")) {
+    if (__builtin_cpu_supports("avx2"))
+      return Level::AVX2;
+    return Level::SSE42;
+  }
+#endif // NDN_CXX_SIMD_X86
+  return Level::SCALAR;
+}
+
+static Kernels
+makeKernels(Level level)
+{
+  Kernels kernels = {Level::SCALAR, &crc32cScalar, &findFirstMismatchScalar};
+#if NDN_CXX_SIMD_X86
+  if (level >= Level::SSE42) {
+    kernels = {Level::SSE42, &crc32cSse42, &findFirstMismatchSse42};
+  }
+  if (level >= Level::AVX2) {
+    kernels = {Level::AVX2, &crc32cSse42, &findFirstMismatchAvx2};
+  }
+#endif // NDN_CXX_SIMD_X86
+  return kernels;
+}
+
+static Kernels&
+getKernels()
+{
+  static Kernels kernels = makeKernels(getSupportedLevel());
+  return kernels;
+}
+
+Level
+getSupportedLevel()
+{
+  static Level supportedLevel = detectLevel();
+  return supportedLevel;
+}
+
+Level
+getLevel()
+{
+  return getKernels().level;
+}
+
+Level
+setLevel(Level level)
+{
+  getKernels() = makeKernels(std::min(level, getSupportedLevel()));
+  return getLevel();
+}
+
+uint32_t
+crc32c(uint32_t crc, const uint8_t* data, size_t size)
+{
+  return getKernels().crc32c(crc, data, size);
+}
+
+size_t
+findFirstMismatch(const uint8_t* first, const uint8_t* second, size_t size)
+{
+  return getKernels().findFirstMismatch(first, second, size);
+}
+
+} // namespace simd
+} // namespace util
+} // namespace ndn
@@ -0,0 +1,89 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_UTIL_SIMD_HPP
+#define NDN_UTIL_SIMD_HPP
+
+#include "../common.hpp"
+
+namespace ndn {
+namespace util {
+namespace simd {
+
+/**
+ * @brief Instruction set used by the byte kernels
+ *
+ * The level is detected at runtime, so the library can be built for a generic target and
+ * still use the vector instructions when the CPU has them.
+ */
+enum class Level {
+  SCALAR, ///< portable implementation
+  SSE42,  ///< SSE4.2 (crc32 instruction, 128-bit compare)
+  AVX2    ///< AVX2 (256-bit compare) in addition to SSE4.2
+};
+
+std::ostream&
+operator<<(std::ostream& os, Level level);
+
+/**
+ * @brief Get the highest level supported by the CPU
+ */
+Level
+getSupportedLevel();
+
+/**
+ * @brief Get the level currently used by the kernels
+ */
+Level
+getLevel();
+
+/**
+ * @brief Restrict the kernels to @p level
+ *
+ * Levels above getSupportedLevel() are lowered to getSupportedLevel().  This is intended for
+ * benchmarks and tests: all levels produce identical results.
+ *
+ * @return the level actually selected
+ */
+Level
+setLevel(Level level);
+
+/**
+ * @brief Update CRC-32C (Castagnoli) value @p crc with octets [@p data, @p data + @p size)
+ *
+ * Pre- and post-conditioning is left to the caller, i.e., the CRC-32C of a buffer is
+ * `crc32c(0xFFFFFFFF, data, size) ^ 0xFFFFFFFF`.
+ */
+uint32_t
+crc32c(uint32_t crc, const uint8_t* data, size_t size);
+
+/**
+ * @brief Find the first octet that differs between two buffers
+ * @return offset of the first differing octet, or @p size if the buffers are equal
+ */
+size_t
+findFirstMismatch(const uint8_t* first, const uint8_t* second, size_t size);
+
+} // namespace simd
+} // namespace util
+} // namespace ndn
+
+#endif // NDN_UTIL_SIMD_HPP
@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "encoding/block-view.hpp"
+#include "encoding/block-helpers.hpp"
+
+#include "boost-test.hpp"
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(EncodingBlockView)
+
+BOOST_AUTO_TEST_CASE(Index)
+{
+  Block outer(100);
+  outer.push_back(makeNonNegativeIntegerBlock(101, 42));
+  outer.push_back(makeStringBlock(102, "view"));
+  outer.push_back(makeEmptyBlock(103));
+  outer.encode();
+
+  BlockView view(outer);
+  BOOST_REQUIRE_EQUAL(view.size(), 3);
+  BOOST_CHECK_EQUAL(view[0].type(), 101);
+  BOOST_CHECK_EQUAL(view[1].type(), 102);
+  BOOST_CHECK_EQUAL(view[2].type(), 103);
+  BOOST_CHECK_EQUAL(view[2].value_size(), 0);
+
+  BOOST_CHECK_EQUAL(readNonNegativeInteger(view.get(101)), 42);
+  BOOST_CHECK_EQUAL(readString(view.get(102)), "view");
+  BOOST_CHECK(view.find(104) == nullptr);
+  BOOST_CHECK_THROW(view.get(104), Block::Error);
+
+  Block inner = view.toBlock(view.get(102));
+  BOOST_CHECK_EQUAL(inner.type(), 102);
+  BOOST_CHECK(inner.getBuffer() == outer.getBuffer());
+  BOOST_CHECK_EQUAL(readString(inner), "view");
+}
+
+BOOST_AUTO_TEST_CASE(Overflow)
+{
+  Block outer(100);
+  size_t nElements = BlockView::INLINE_CAPACITY * 2 + 1;
+  for (size_t i = 0; i < nElements; ++i) {
+    outer.push_back(makeNonNegativeIntegerBlock(200 + i, i));
+  }
+  outer.encode();
+
+  BlockView view(outer);
+  BOOST_REQUIRE_EQUAL(view.size(), nElements);
+  for (size_t i = 0; i < nElements; ++i) {
+    BOOST_CHECK_EQUAL(view[i].type(), 200 + i);
+    BOOST_CHECK_EQUAL(readNonNegativeInteger(view[i]), i);
+  }
+  BOOST_CHECK_EQUAL(readNonNegativeInteger(view.get(200 + nElements - 1)), nElements - 1);
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  static const uint8_t WIRE[] = {
+    0x64, 0x04, // type 100, length 4
+      0x65, 0x05, 0x01, 0x02 // type 101, length 5 exceeds the remaining 2 octets
+  };
+
+  Block outer(WIRE, sizeof(WIRE));
+  BOOST_CHECK_THROW(BlockView view(outer), tlv::Error);
+  BOOST_CHECK_THROW(outer.parse(), tlv::Error);
+  BOOST_CHECK_EQUAL(outer.elements_size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace ndn
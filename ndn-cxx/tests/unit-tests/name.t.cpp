@@ -559,6 +559,55 @@ BOOST_AUTO_TEST_CASE(SubNameOutOfRangeIndexes)
   BOOST_CHECK_EQUAL("/first/second/last", name.getSubName(-10, 10));
 }
 
+BOOST_AUTO_TEST_CASE(Hashes)
+{
+  Name name("/first/second/last");
+  std::vector<size_t> prefixHashes = name.getPrefixHashes();
+  BOOST_REQUIRE_EQUAL(prefixHashes.size(), 4);
+
+  BOOST_CHECK_EQUAL(name.getPrefixHash(0), 0);
+  BOOST_CHECK_EQUAL(name.getPrefixHash(3), std::hash<Name>()(name));
+  for (size_t i = 0; i < name.size(); ++i) {
+    BOOST_CHECK_EQUAL(name.getComponentHash(i), std::hash<name::Component>()(name.get(i)));
+    BOOST_CHECK_EQUAL(name.getPrefixHash(i + 1), std::hash<Name>()(name.getPrefix(i + 1)));
+  }
+
+  Name copy = name;
+  copy.append("more");
+  BOOST_CHECK_EQUAL(copy.getPrefixHashes().size(), 5);
+  BOOST_CHECK_EQUAL(copy.getPrefixHash(3), prefixHashes[3]);
+  BOOST_CHECK_EQUAL(name.getPrefixHashes().size(), 4);
+
+  Name decoded(name.wireEncode());
+  BOOST_CHECK(decoded.getPrefixHashes() == prefixHashes);
+}
+
+BOOST_AUTO_TEST_CASE(CompareEncoded)
+{
+  // names with wire encoding are compared as a whole before falling back to components
+  std::vector<Name> names{"/", "/A", "/A/B", "/A/BC", "/A/B/C", "/AB", "/B",
+                          Name("/A").appendNumber(300), Name("/A").append(std::string(300, 'x'))};
+  for (const Name& first : names) {
+    Name firstEncoded(first.wireEncode());
+    for (const Name& second : names) {
+      Name secondEncoded(second.wireEncode());
+      BOOST_CHECK_EQUAL(firstEncoded == secondEncoded, first == second);
+      BOOST_CHECK_EQUAL(firstEncoded.isPrefixOf(secondEncoded), first.isPrefixOf(second));
+      BOOST_CHECK_EQUAL(firstEncoded.compare(secondEncoded) < 0, first.compare(second) < 0);
+      BOOST_CHECK_EQUAL(firstEncoded.compare(secondEncoded) > 0, first.compare(second) > 0);
+    }
+  }
+
+  // components with equal TLV-VALUEs but different TLV-TYPEs are different
+  uint8_t digest[32] = {0};
+  Name withDigest("/A");
+  withDigest.append(name::Component::fromImplicitSha256Digest(digest, sizeof(digest)));
+  Name withGeneric("/A");
+  withGeneric.append(digest, sizeof(digest));
+  BOOST_CHECK_NE(Name(withDigest.wireEncode()), Name(withGeneric.wireEncode()));
+  BOOST_CHECK(!Name(withDigest.wireEncode()).isPrefixOf(withGeneric));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace tests
@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2015 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "util/simd.hpp"
+
+#include "boost-test.hpp"
+
+namespace ndn {
+namespace util {
+namespace simd {
+namespace tests {
+
+class LevelFixture
+{
+public:
+  LevelFixture()
+    : m_originalLevel(getLevel())
+  {
+  }
+
+  ~LevelFixture()
+  {
+    setLevel(m_originalLevel);
+  }
+
+  std::vector<Level>
+  getLevels() const
+  {
+    std::vector<Level> levels{Level::SCALAR};
+    if (getSupportedLevel() >= Level::SSE42)
+      levels.push_back(Level::SSE42);
+    if (getSupportedLevel() >= Level::AVX2)
+      levels.push_back(Level::AVX2);
+    return levels;
+  }
+
+private:
+  Level m_originalLevel;
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilSimd, LevelFixture)
+
+BOOST_AUTO_TEST_CASE(SetLevel)
+{
+  BOOST_CHECK_EQUAL(getLevel(), getSupportedLevel());
+  BOOST_CHECK_EQUAL(setLevel(Level::SCALAR), Level::SCALAR);
+  BOOST_CHECK_EQUAL(getLevel(), Level::SCALAR);
+  BOOST_CHECK_EQUAL(setLevel(Level::AVX2), getSupportedLevel());
+}
+
+BOOST_AUTO_TEST_CASE(Crc32c)
+{
+  const std::string check = "123456789";
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(check.data());
+
+  std::vector<uint8_t> buffer(1000);
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    buffer[i] = static_cast<uint8_t>(i * 7 + 3);
+  }
+
+  uint32_t expected = 0;
+  for (Level level : getLevels()) {
+    BOOST_TEST_MESSAGE(level);
+    setLevel(level);
+    BOOST_CHECK_EQUAL(crc32c(0xFFFFFFFF, data, check.size()) ^ 0xFFFFFFFF, 0xE3069283);
+    BOOST_CHECK_EQUAL(crc32c(0xFFFFFFFF, data, 0), 0xFFFFFFFF);
+
+    // incremental update gives the same result as a single update
+    uint32_t crc = crc32c(0xFFFFFFFF, buffer.data(), 13);
+    crc = crc32c(crc, buffer.data() + 13, buffer.size() - 13);
+    BOOST_CHECK_EQUAL(crc, crc32c(0xFFFFFFFF, buffer.data(), buffer.size()));
+
+    if (level == Level::SCALAR)
+      expected = crc;
+    BOOST_CHECK_EQUAL(crc, expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(FindFirstMismatch)
+{
+  std::vector<uint8_t> first(100);
+  for (size_t i = 0; i < first.size(); ++i) {
+    first[i] = static_cast<uint8_t>(i);
+  }
+
+  for (Level level : getLevels()) {
+    BOOST_TEST_MESSAGE(level);
+    setLevel(level);
+
+    std::vector<uint8_t> second = first;
+    BOOST_CHECK_EQUAL(findFirstMismatch(first.data(), second.data(), first.size()), first.size());
+    BOOST_CHECK_EQUAL(findFirstMismatch(first.data(), second.data(), 0), 0);
+
+    for (size_t pos : {0, 1, 7, 8, 15, 16, 31, 32, 33, 63, 64, 99}) {
+      second = first;
+      second[pos] ^= 0x80;
+      BOOST_CHECK_EQUAL(findFirstMismatch(first.data(), second.data(), first.size()), pos);
+      BOOST_CHECK_EQUAL(findFirstMismatch(first.data(), second.data(), pos), pos);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace simd
+} // namespace util
+} // namespace ndn
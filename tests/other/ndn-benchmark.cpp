@@ -0,0 +1,413 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/point-to-point-layout-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+#include "ns3/ndnSIM/utils/topology/rocketfuel-map-reader.hpp"
+#include "ns3/ndnSIM/model/cs/ndn-content-store.hpp"
+#include "ns3/ndnSIM/model/ndn-net-device-face.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <limits>
+
+namespace ns3 {
+
+/**
+ * Whole-simulation benchmark: forwarding cost of a representative workload.
+ *
+ * Topologies:
+ *  - grid: NxN grid (PointToPointGrid), producer in the far corner, consumers in the first
+ *    column
+ *  - rocketfuel: Rocketfuel map (--rocketfuel=<file.cch>), producer on a backbone router,
+ *    consumers on customer routers
+ *
+ * Workloads:
+ *  - cbr: ConsumerCbr, every Interest is for new content
+ *  - zipf: ConsumerZipfMandelbrot, repeated requests are served from caches
+ *  - validation: zipf, with producer content updates, exercising the cache-validation
+ *    signal path
+ *
+ * After the run, one JSON object is printed (or appended to --output) with the wall time,
+ * forwarded packets per second of wall time, peak RSS sampled with MemUsage::Get during
+ * the run, and the sizes of forwarding tables summed over all nodes.  The number of packets
+ * and link frames sent by NetDeviceFaces shows how many frames (and thus simulator events of
+ * link transmission and reception) are saved with --aggregation-window.
+ *
+ *     ./waf --run "ndn-benchmark --topology=grid --workload=zipf --cs-size=100"
+ *
+ * tests/other/ndn-benchmark.sh runs the standard suite and collects the results into a
+ * JSON array.
+ */
+class Benchmark {
+public:
+  Benchmark()
+    : m_topology("grid")
+    , m_gridSize(5)
+    , m_workload("zipf")
+    , m_csSize(100)
+    , m_strategy("/localhost/nfd/strategy/best-route")
+    , m_interestRate(100)
+    , m_nContents(1000)
+    , m_zipfS(0.8)
+    , m_simulationTime(Seconds(20))
+    , m_aggregationWindow(0)
+    , m_initialRss(0)
+    , m_peakRss(0)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  void
+  createGrid();
+
+  void
+  createRocketfuel();
+
+  void
+  installApps();
+
+  void
+  sampleMemory();
+
+  void
+  printResults(std::ostream& os, double setupWallTime, double wallTime) const;
+
+private:
+  std::string m_label;
+  std::string m_topology;
+  uint32_t m_gridSize;
+  std::string m_rocketfuelFile;
+  std::string m_workload;
+  std::string m_oldContentStore;
+  uint32_t m_csSize;
+  std::string m_strategy;
+  double m_interestRate;
+  uint32_t m_nContents;
+  double m_zipfS;
+  Time m_simulationTime;
+  Time m_aggregationWindow;
+  std::string m_output;
+
+  NodeContainer m_nodes;
+  Ptr<Node> m_producer;
+  NodeContainer m_consumers;
+
+  int64_t m_initialRss;
+  int64_t m_peakRss;
+};
+
+void
+Benchmark::createGrid()
+{
+  PointToPointHelper p2p;
+  PointToPointGridHelper grid(m_gridSize, m_gridSize, p2p);
+  grid.BoundingBox(100, 100, 200, 200);
+
+  for (uint32_t row = 0; row < m_gridSize; ++row) {
+    for (uint32_t col = 0; col < m_gridSize; ++col) {
+      m_nodes.Add(grid.GetNode(row, col));
+    }
+    m_consumers.Add(grid.GetNode(row, 0));
+  }
+  m_producer = grid.GetNode(m_gridSize - 1, m_gridSize - 1);
+}
+
+void
+Benchmark::createRocketfuel()
+{
+  if (m_rocketfuelFile.empty()) {
+    NS_FATAL_ERROR("--rocketfuel=<file.cch> is required for the rocketfuel topology");
+  }
+
+  RocketfuelParams params;
+  params.averageRtt = 2.0;
+  params.clientNodeDegrees = 2;
+  params.minb2bBandwidth = "40Mbps";
+  params.minb2bDelay = "5ms";
+  params.maxb2bBandwidth = "100Mbps";
+  params.maxb2bDelay = "10ms";
+  params.minb2gBandwidth = "10Mbps";
+  params.minb2gDelay = "5ms";
+  params.maxb2gBandwidth = "20Mbps";
+  params.maxb2gDelay = "10ms";
+  params.ming2cBandwidth = "1Mbps";
+  params.ming2cDelay = "10ms";
+  params.maxg2cBandwidth = "3Mbps";
+  params.maxg2cDelay = "70ms";
+
+  RocketfuelMapReader reader(m_rocketfuelFile, 1.0);
+  m_nodes = reader.Read(params);
+  if (reader.GetBackboneRouters().GetN() == 0 || reader.GetCustomerRouters().GetN() == 0) {
+    NS_FATAL_ERROR("Rocketfuel topology " << m_rocketfuelFile
+                   << " does not have backbone and customer routers");
+  }
+
+  m_producer = reader.GetBackboneRouters().Get(0);
+  m_consumers = reader.GetCustomerRouters();
+}
+
+void
+Benchmark::installApps()
+{
+  std::string prefix = "/prefix";
+
+  if (m_workload == "cbr") {
+    ndn::AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+    consumerHelper.SetPrefix(prefix);
+    consumerHelper.SetAttribute("Frequency", DoubleValue(m_interestRate));
+    consumerHelper.Install(m_consumers);
+  }
+  else if (m_workload == "zipf" || m_workload == "validation") {
+    ndn::AppHelper consumerHelper("ns3::ndn::ConsumerZipfMandelbrot");
+    consumerHelper.SetPrefix(prefix);
+    consumerHelper.SetAttribute("Frequency", DoubleValue(m_interestRate));
+    consumerHelper.SetAttribute("NumberOfContents", UintegerValue(m_nContents));
+    consumerHelper.SetAttribute("q", DoubleValue(0));
+    consumerHelper.SetAttribute("s", DoubleValue(m_zipfS));
+    consumerHelper.Install(m_consumers);
+  }
+  else {
+    NS_FATAL_ERROR("Unknown workload " << m_workload);
+  }
+
+  ndn::AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetPrefix(prefix);
+  producerHelper.SetAttribute("PayloadSize", StringValue("1024"));
+  uint32_t simulationSeconds = static_cast<uint32_t>(m_simulationTime.GetSeconds());
+  producerHelper.SetAttribute("ExprimentTime", UintegerValue(simulationSeconds));
+  if (m_workload == "validation") {
+    // content is updated several times during the run
+    producerHelper.SetAttribute("AverageUpdateTime",
+                                UintegerValue(std::max<uint32_t>(simulationSeconds / 4, 1)));
+  }
+  else {
+    // update period far beyond the run: cbr and zipf measure plain forwarding without updates
+    producerHelper.SetAttribute("AverageUpdateTime",
+                                UintegerValue(std::numeric_limits<int32_t>::max() / 2));
+  }
+  producerHelper.Install(m_producer);
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+  ndnGlobalRoutingHelper.AddOrigins(prefix, m_producer);
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+}
+
+void
+Benchmark::sampleMemory()
+{
+  m_peakRss = std::max(m_peakRss, MemUsage::Get());
+  Simulator::Schedule(m_simulationTime / 100, &Benchmark::sampleMemory, this);
+}
+
+void
+Benchmark::printResults(std::ostream& os, double setupWallTime, double wallTime) const
+{
+  uint64_t nInInterests = 0, nOutInterests = 0, nInData = 0, nOutData = 0;
+  uint64_t nCsExactNameHits = 0, nCsRangeLookups = 0;
+  uint64_t nLinkPackets = 0, nLinkFrames = 0;
+  size_t nameTreeSize = 0, fibSize = 0, pitSize = 0, csSize = 0, measurementsSize = 0,
+         deadNonceListSize = 0;
+
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    Ptr<ndn::L3Protocol> l3 = (*node)->GetObject<ndn::L3Protocol>();
+    if (l3 == 0)
+      continue;
+    shared_ptr<nfd::Forwarder> forwarder = l3->getForwarder();
+
+    nInInterests += forwarder->getCounters().getNInInterests();
+    nOutInterests += forwarder->getCounters().getNOutInterests();
+    nInData += forwarder->getCounters().getNInDatas();
+    nOutData += forwarder->getCounters().getNOutDatas();
+
+    nameTreeSize += forwarder->getNameTree().size();
+    fibSize += forwarder->getFib().size();
+    pitSize += forwarder->getPit().size();
+    measurementsSize += forwarder->getMeasurements().size();
+    deadNonceListSize += forwarder->getDeadNonceList().size();
+
+    Ptr<ndn::ContentStore> cs = (*node)->GetObject<ndn::ContentStore>();
+    if (cs != 0)
+      csSize += cs->GetSize();
+    else
+      csSize += forwarder->getCs().size();
+
+    nCsExactNameHits += forwarder->getCs().getLookupCounters().nExactNameHits;
+    nCsRangeLookups += forwarder->getCs().getLookupCounters().nRangeLookups;
+
+    for (const auto& face : forwarder->getFaceTable()) {
+      auto netDeviceFace = std::dynamic_pointer_cast<ndn::NetDeviceFace>(face);
+      if (netDeviceFace != nullptr) {
+        nLinkPackets += netDeviceFace->getCounters().getNOutInterests() +
+                        netDeviceFace->getCounters().getNOutDatas();
+        nLinkFrames += netDeviceFace->getNOutFrames();
+      }
+    }
+  }
+
+  uint64_t nPackets = nInInterests + nInData;
+
+  os << "{"
+     << "\"label\": \"" << m_label << "\", "
+     << "\"topology\": \"" << m_topology << "\", "
+     << "\"nodes\": " << m_nodes.GetN() << ", "
+     << "\"consumers\": " << m_consumers.GetN() << ", "
+     << "\"workload\": \"" << m_workload << "\", "
+     << "\"contentStore\": \"" << (m_oldContentStore.empty() ? "nfd" : m_oldContentStore) << "\", "
+     << "\"csSize\": " << m_csSize << ", "
+     << "\"strategy\": \"" << m_strategy << "\", "
+     << "\"interestRate\": " << m_interestRate << ", "
+     << "\"simulationTime\": " << m_simulationTime.GetSeconds() << ", "
+     << "\"aggregationWindow\": " << m_aggregationWindow.GetSeconds() << ", "
+     << "\"setupWallTime\": " << setupWallTime << ", "
+     << "\"wallTime\": " << wallTime << ", "
+     << "\"packets\": {"
+     << "\"inInterests\": " << nInInterests << ", "
+     << "\"outInterests\": " << nOutInterests << ", "
+     << "\"inData\": " << nInData << ", "
+     << "\"outData\": " << nOutData << "}, "
+     << "\"link\": {"
+     << "\"packets\": " << nLinkPackets << ", "
+     << "\"frames\": " << nLinkFrames << "}, "
+     << "\"csLookups\": {"
+     << "\"exactNameHits\": " << nCsExactNameHits << ", "
+     << "\"rangeLookups\": " << nCsRangeLookups << "}, "
+     << "\"packetsPerSecond\": " << (wallTime > 0 ? nPackets / wallTime : 0) << ", "
+     << "\"memory\": {"
+     << "\"initialRss\": " << m_initialRss << ", "
+     << "\"peakRss\": " << m_peakRss << "}, "
+     << "\"tables\": {"
+     << "\"nameTree\": " << nameTreeSize << ", "
+     << "\"fib\": " << fibSize << ", "
+     << "\"pit\": " << pitSize << ", "
+     << "\"cs\": " << csSize << ", "
+     << "\"measurements\": " << measurementsSize << ", "
+     << "\"deadNonceList\": " << deadNonceListSize << "}"
+     << "}" << std::endl;
+}
+
+int
+Benchmark::run(int argc, char* argv[])
+{
+#ifdef _DEBUG
+  std::cerr << "Benchmark compiled in debug mode is unreliable, "
+            << "please compile in release mode." << std::endl;
+#endif // _DEBUG
+
+  // setting default parameters for PointToPoint links and channels
+  Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("100Mbps"));
+  Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+  Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("100"));
+
+  CommandLine cmd;
+  cmd.AddValue("label", "Label of the run in the results", m_label);
+  cmd.AddValue("topology", "Topology (grid, rocketfuel)", m_topology);
+  cmd.AddValue("grid-size", "Number of rows and columns of the grid topology", m_gridSize);
+  cmd.AddValue("rocketfuel", "Rocketfuel map file (.cch) for the rocketfuel topology",
+               m_rocketfuelFile);
+  cmd.AddValue("workload", "Workload (cbr, zipf, validation)", m_workload);
+  cmd.AddValue("old-cs", "Old content store to use "
+                         "(e.g., ns3::ndn::cs::Lru, ns3::ndn::cs::Lfu, ...), NFD's CS if empty",
+               m_oldContentStore);
+  cmd.AddValue("cs-size", "Maximum number of cached packets per node", m_csSize);
+  cmd.AddValue("strategy", "Forwarding strategy", m_strategy);
+  cmd.AddValue("rate", "Interest rate of each consumer", m_interestRate);
+  cmd.AddValue("contents", "Number of contents for zipf and validation workloads", m_nContents);
+  cmd.AddValue("s", "Zipf exponent for zipf and validation workloads", m_zipfS);
+  cmd.AddValue("sim-time", "Simulation time", m_simulationTime);
+  cmd.AddValue("aggregation-window", "Aggregation window of NetDeviceFaces, 0 to disable",
+               m_aggregationWindow);
+  cmd.AddValue("output", "File to append results to, standard output if empty", m_output);
+  cmd.Parse(argc, argv);
+
+  if (m_label.empty()) {
+    m_label = m_topology + "-" + m_workload + "-" +
+              (m_oldContentStore.empty() ? "nfd" : m_oldContentStore) + "-" +
+              std::to_string(m_csSize);
+  }
+
+  std::chrono::steady_clock::time_point setupBegin = std::chrono::steady_clock::now();
+
+  if (m_topology == "grid") {
+    createGrid();
+  }
+  else if (m_topology == "rocketfuel") {
+    createRocketfuel();
+  }
+  else {
+    NS_FATAL_ERROR("Unknown topology " << m_topology);
+  }
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.setCsSize(m_csSize);
+  ndnHelper.setFaceAggregationWindow(m_aggregationWindow);
+  if (!m_oldContentStore.empty()) {
+    ndnHelper.SetOldContentStore(m_oldContentStore, "MaxSize", std::to_string(m_csSize));
+  }
+  ndnHelper.InstallAll();
+
+  ndn::StrategyChoiceHelper::InstallAll("/", m_strategy);
+
+  installApps();
+
+  std::chrono::steady_clock::time_point runBegin = std::chrono::steady_clock::now();
+
+  m_initialRss = MemUsage::Get();
+  m_peakRss = m_initialRss;
+  Simulator::Schedule(Seconds(0), &Benchmark::sampleMemory, this);
+  Simulator::Stop(m_simulationTime);
+  Simulator::Run();
+
+  std::chrono::steady_clock::time_point runEnd = std::chrono::steady_clock::now();
+  m_peakRss = std::max(m_peakRss, MemUsage::Get());
+
+  double setupWallTime = std::chrono::duration<double>(runBegin - setupBegin).count();
+  double wallTime = std::chrono::duration<double>(runEnd - runBegin).count();
+  if (m_output.empty()) {
+    printResults(std::cout, setupWallTime, wallTime);
+  }
+  else {
+    std::ofstream os(m_output, std::ios::app);
+    printResults(os, setupWallTime, wallTime);
+  }
+
+  Simulator::Destroy();
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::Benchmark benchmark;
+  return benchmark.run(argc, argv);
+}
@@ -0,0 +1,54 @@
+#!/bin/bash
+
+# Runs the standard ndn-benchmark suite and writes the results as a JSON array
+#
+# usage: ./ndn-benchmark.sh [results.json] [rocketfuel-map.cch]
+
+output=${1:-ndn-benchmark.json}
+rocketfuel=$2
+lines=$(mktemp)
+
+run() {
+  ../../../waf --run ndn-benchmark --command-template="%s $* --output=${lines}" || exit 1
+}
+
+sim_time=20
+
+# forwarding without caching benefit
+echo "Grid, CBR consumers.."
+run --topology=grid --workload=cbr --sim-time=${sim_time}
+
+# CS policies and sizes under Zipf popularity
+for size in 100 1000 10000; do
+  echo "Grid, Zipf consumers, NFD CS, size ${size}.."
+  run --topology=grid --workload=zipf --cs-size=${size} --sim-time=${sim_time}
+
+  for cs in ns3::ndn::cs::Lru ns3::ndn::cs::Lfu ns3::ndn::cs::Fifo ns3::ndn::cs::Random; do
+    echo "Grid, Zipf consumers, ${cs}, size ${size}.."
+    run --topology=grid --workload=zipf --old-cs=${cs} --cs-size=${size} --sim-time=${sim_time}
+  done
+done
+
+# aggregation of small packets into link frames on a dense topology
+for window in 0ms 1ms 5ms; do
+  echo "Grid 10x10, CBR consumers, aggregation window ${window}.."
+  run --topology=grid --grid-size=10 --workload=cbr --rate=1000 --aggregation-window=${window} \
+      --label=grid10-cbr-aggregation-${window} --sim-time=${sim_time}
+done
+
+# cache-validation signal path
+echo "Grid, validation.."
+run --topology=grid --workload=validation --old-cs=ns3::ndn::cs::Lru --sim-time=${sim_time}
+
+if [ -n "${rocketfuel}" ]; then
+  echo "Rocketfuel, Zipf consumers.."
+  run --topology=rocketfuel --rocketfuel=${rocketfuel} --workload=zipf --sim-time=${sim_time}
+  echo "Rocketfuel, validation.."
+  run --topology=rocketfuel --rocketfuel=${rocketfuel} --workload=validation \
+      --old-cs=ns3::ndn::cs::Lru --sim-time=${sim_time}
+fi
+
+(echo "["; sed '$!s/$/,/' ${lines}; echo "]") > ${output}
+rm -f ${lines}
+
+echo "Results written to ${output}"
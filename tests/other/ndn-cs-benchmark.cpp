@@ -0,0 +1,178 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-cs-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM/model/cs/ndn-content-store.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * Benchmark of old content store implementations: hit ratio and lookup throughput.
+ *
+ * A stream of requests for contents with Zipf-Mandelbrot popularity is replayed against each
+ * store: every request is a Lookup, and a miss is followed by an Add of the Data.  With
+ * --shift, the popularity ranking is rotated by half of the contents in the middle of the
+ * stream, showing how fast each policy forgets formerly popular contents.
+ *
+ *     ./waf --run "ndn-cs-benchmark --cs-size=1000 --contents=100000 --shift=1"
+ */
+class CsBenchmark {
+public:
+  CsBenchmark()
+    : m_stores("ns3::ndn::cs::Lru,ns3::ndn::cs::Fifo,ns3::ndn::cs::Lfu,"
+               "ns3::ndn::cs::BucketLfu,ns3::ndn::cs::WTinyLfu")
+    , m_csSize(1000)
+    , m_nContents(100000)
+    , m_nRequests(1000000)
+    , m_zipfS(0.8)
+    , m_zipfQ(0)
+    , m_shift(false)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  void
+  makeWorkload();
+
+  void
+  measure(const std::string& store) const;
+
+private:
+  std::string m_stores;
+  uint32_t m_csSize;
+  uint32_t m_nContents;
+  uint32_t m_nRequests;
+  double m_zipfS;
+  double m_zipfQ;
+  bool m_shift;
+
+  std::vector<shared_ptr<const Interest>> m_interests;
+  std::vector<shared_ptr<const Data>> m_data;
+  std::vector<uint32_t> m_requests;
+};
+
+void
+CsBenchmark::makeWorkload()
+{
+  for (uint32_t i = 0; i < m_nContents; ++i) {
+    Name name = Name("/benchmark/cs").appendNumber(i % 100).appendSegment(i);
+    m_interests.push_back(make_shared<Interest>(name));
+
+    auto data = make_shared<Data>(name);
+    data->setContent(make_shared< ::ndn::Buffer>(1024));
+    m_data.push_back(data);
+  }
+
+  std::vector<double> cdf(m_nContents);
+  double sum = 0;
+  for (uint32_t rank = 0; rank < m_nContents; ++rank) {
+    sum += 1.0 / std::pow(rank + 1 + m_zipfQ, m_zipfS);
+    cdf[rank] = sum;
+  }
+
+  // same request stream for every store
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> distribution(0, sum);
+  for (uint32_t i = 0; i < m_nRequests; ++i) {
+    uint32_t rank = std::lower_bound(cdf.begin(), cdf.end(), distribution(generator)) - cdf.begin();
+    rank = std::min(rank, m_nContents - 1);
+    if (m_shift && i >= m_nRequests / 2) {
+      rank = (rank + m_nContents / 2) % m_nContents;
+    }
+    m_requests.push_back(rank);
+  }
+}
+
+void
+CsBenchmark::measure(const std::string& store) const
+{
+  ObjectFactory factory(store);
+  factory.Set("MaxSize", StringValue(std::to_string(m_csSize)));
+  Ptr<ContentStore> cs = factory.Create<ContentStore>();
+
+  uint64_t nHits = 0;
+  std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+  for (uint32_t content : m_requests) {
+    if (cs->Lookup(m_interests[content]) != nullptr) {
+      ++nHits;
+    }
+    else {
+      cs->Add(m_data[content]);
+    }
+  }
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  double seconds = std::chrono::duration<double>(end - begin).count();
+  std::cout << store << "\t" << m_requests.size() << "\t"
+            << static_cast<double>(nHits) / m_requests.size() << "\t" << seconds << "\t"
+            << (m_requests.size() / seconds) << std::endl;
+}
+
+int
+CsBenchmark::run(int argc, char* argv[])
+{
+#ifdef _DEBUG
+  std::cerr << "Benchmark compiled in debug mode is unreliable, "
+            << "please compile in release mode." << std::endl;
+#endif // _DEBUG
+
+  CommandLine cmd;
+  cmd.AddValue("stores", "Comma-separated list of content stores", m_stores);
+  cmd.AddValue("cs-size", "Maximum number of cached packets", m_csSize);
+  cmd.AddValue("contents", "Number of contents", m_nContents);
+  cmd.AddValue("requests", "Number of requests", m_nRequests);
+  cmd.AddValue("s", "Zipf-Mandelbrot exponent", m_zipfS);
+  cmd.AddValue("q", "Zipf-Mandelbrot plateau", m_zipfQ);
+  cmd.AddValue("shift", "Rotate popularity ranking in the middle of the stream", m_shift);
+  cmd.Parse(argc, argv);
+
+  makeWorkload();
+
+  std::cout << "Store\tRequests\tHitRatio\tWallTime\tRequestsPerSecond" << std::endl;
+  std::istringstream stores(m_stores);
+  std::string store;
+  while (std::getline(stores, store, ',')) {
+    measure(store);
+  }
+  return 0;
+}
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::ndn::CsBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
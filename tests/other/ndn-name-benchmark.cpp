@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-decode-benchmark.cpp
+
+// ndn-name-benchmark.cpp
+
+#include "ns3/ndnSIM/ndn-cxx/name.hpp"
+#include "ns3/ndnSIM/ndn-cxx/util/simd.hpp"
+#include "ns3/ndnSIM/ndn-cxx/util/time.hpp"
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace ndn {
+
+/**
+ * Microbenchmark of Name hashing and comparison kernels.
+ *
+ * Names follow a typical content naming scheme: a few popular site prefixes, a path of
+ * 1 to 5 components with 3 to 20 characters, a version and a segment number.  Every
+ * operation is measured for each instruction set level supported by the CPU.
+ *
+ *     ./waf --run ndn-name-benchmark
+ */
+class NameBenchmark {
+public:
+  NameBenchmark()
+    : m_nNames(10000)
+    , m_nRounds(50)
+  {
+  }
+
+  void
+  run();
+
+private:
+  void
+  makeNames();
+
+  /**
+   * @brief Run @p op on every name m_nRounds times and print the operation rate
+   */
+  template<class Op>
+  void
+  measure(const std::string& label, const Op& op) const
+  {
+    size_t nMatched = 0; // keeps the operation from being optimized out
+    time::steady_clock::TimePoint begin = time::steady_clock::now();
+    for (size_t round = 0; round < m_nRounds; ++round) {
+      for (size_t i = 0; i < m_names.size(); ++i) {
+        nMatched += op(i) ? 1 : 0;
+      }
+    }
+    time::steady_clock::TimePoint end = time::steady_clock::now();
+
+    double seconds = time::duration_cast<time::microseconds>(end - begin).count() / 1000000.0;
+    size_t nOps = m_names.size() * m_nRounds;
+    std::cout << util::simd::getLevel() << "\t" << label << "\t" << nOps << "\t" << seconds
+              << "\t" << (nOps / seconds) << "\t" << nMatched << std::endl;
+  }
+
+private:
+  size_t m_nNames;
+  size_t m_nRounds;
+
+  std::vector<Block> m_wires;    ///< encoded names
+  std::vector<Name> m_names;     ///< decoded names
+  std::vector<Name> m_copies;    ///< equal names decoded from separate buffers
+  std::vector<Name> m_siblings;  ///< names differing in the last component
+  std::vector<Name> m_prefixes;  ///< names without version and segment
+  std::vector<Name> m_built;     ///< equal names built component by component (no wire)
+};
+
+void
+NameBenchmark::makeNames()
+{
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<size_t> sites(0, 15);
+  std::uniform_int_distribution<size_t> pathLength(1, 5);
+  std::uniform_int_distribution<size_t> componentLength(3, 20);
+  std::uniform_int_distribution<int> character('a', 'z');
+
+  for (size_t i = 0; i < m_nNames; ++i) {
+    Name prefix("/ndn/edu");
+    prefix.append("site" + std::to_string(sites(rng)));
+    for (size_t j = 0, n = pathLength(rng); j < n; ++j) {
+      std::string component(componentLength(rng), 'a');
+      for (char& c : component) {
+        c = static_cast<char>(character(rng));
+      }
+      prefix.append(component);
+    }
+
+    Name name = prefix;
+    name.appendVersion(i).appendSegment(i % 64);
+
+    m_wires.push_back(name.wireEncode());
+    m_names.push_back(Name(m_wires.back()));
+    m_copies.push_back(Name(Block(m_wires.back().wire(), m_wires.back().size())));
+    m_siblings.push_back(Name(name.getPrefix(-1).appendSegment(i % 64 + 1).wireEncode()));
+    m_prefixes.push_back(Name(prefix.wireEncode()));
+    m_built.push_back(name.getPrefix(name.size()));
+  }
+}
+
+void
+NameBenchmark::run()
+{
+#ifdef _DEBUG
+  std::cerr << "Benchmark compiled in debug mode is unreliable, "
+            << "please compile in release mode." << std::endl;
+#endif // _DEBUG
+
+  makeNames();
+
+  std::vector<util::simd::Level> levels{util::simd::Level::SCALAR};
+  if (util::simd::getSupportedLevel() >= util::simd::Level::SSE42)
+    levels.push_back(util::simd::Level::SSE42);
+  if (util::simd::getSupportedLevel() >= util::simd::Level::AVX2)
+    levels.push_back(util::simd::Level::AVX2);
+
+  std::cout << "Level\tOperation\tCount\tWallTime\tOpsPerSecond\tMatched" << std::endl;
+  for (util::simd::Level level : levels) {
+    util::simd::setLevel(level);
+
+    measure("HashPrefixes", [this] (size_t i) {
+        Name name(m_wires[i]); // hashes are cached, so they are computed on a fresh Name
+        return name.getPrefixHashes().back() != 0;
+      });
+    measure("Equal", [this] (size_t i) {
+        return m_names[i] == m_copies[i];
+      });
+    measure("EqualWithoutWire", [this] (size_t i) {
+        return m_names[i] == m_built[i];
+      });
+    measure("NotEqual", [this] (size_t i) {
+        return m_names[i] == m_siblings[i];
+      });
+    measure("IsPrefixOf", [this] (size_t i) {
+        return m_prefixes[i].isPrefixOf(m_names[i]);
+      });
+    measure("Compare", [this] (size_t i) {
+        return m_names[i].compare(m_names[(i + 1) % m_names.size()]) < 0;
+      });
+  }
+
+  util::simd::setLevel(util::simd::getSupportedLevel());
+}
+
+} // namespace ndn
+
+int
+main(int argc, char* argv[])
+{
+  ndn::NameBenchmark benchmark;
+  benchmark.run();
+  return 0;
+}
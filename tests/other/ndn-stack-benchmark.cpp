@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-stack-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+
+#include <chrono>
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * Benchmark of NDN stack installation: memory and time per node.
+ *
+ * Nodes are connected into a chain with point-to-point links, so that each node has one or
+ * two NetDeviceFaces.  Memory is the growth of resident set size caused by installing the
+ * stack and running the initialization events scheduled at time 0 (e.g., RIB managers),
+ * divided by the number of nodes.
+ *
+ *     ./waf --run "ndn-stack-benchmark --nodes=10000"
+ *     ./waf --run "ndn-stack-benchmark --nodes=10000 --data-plane-only=1"
+ */
+class StackBenchmark {
+public:
+  StackBenchmark()
+    : m_nNodes(10000)
+    , m_isDataPlaneOnly(false)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  template<class F>
+  double
+  measure(F f) const
+  {
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    f();
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - begin).count();
+  }
+
+private:
+  uint32_t m_nNodes;
+  bool m_isDataPlaneOnly;
+};
+
+int
+StackBenchmark::run(int argc, char* argv[])
+{
+#ifdef _DEBUG
+  std::cerr << "Benchmark compiled in debug mode is unreliable, "
+            << "please compile in release mode." << std::endl;
+#endif // _DEBUG
+
+  CommandLine cmd;
+  cmd.AddValue("nodes", "Number of nodes", m_nNodes);
+  cmd.AddValue("data-plane-only", "Install stack without NFD management and RIB managers",
+               m_isDataPlaneOnly);
+  cmd.Parse(argc, argv);
+
+  NodeContainer nodes;
+  nodes.Create(m_nNodes);
+
+  PointToPointHelper p2p;
+  for (uint32_t i = 1; i < m_nNodes; ++i) {
+    p2p.Install(nodes.Get(i - 1), nodes.Get(i));
+  }
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.setDataPlaneOnly(m_isDataPlaneOnly);
+
+  int64_t rssBefore = MemUsage::Get();
+
+  double installTime = measure([&] { ndnHelper.Install(nodes); });
+
+  // let initialization events scheduled at time 0 run
+  double startupTime = measure([] {
+      Simulator::Stop(MilliSeconds(1));
+      Simulator::Run();
+    });
+
+  int64_t rssAfter = MemUsage::Get();
+
+  std::cout << "Nodes\t" << m_nNodes << std::endl
+            << "DataPlaneOnly\t" << m_isDataPlaneOnly << std::endl
+            << "InstallTime\t" << installTime << std::endl
+            << "StartupTime\t" << startupTime << std::endl
+            << "InstallTimePerNode\t" << (installTime + startupTime) / m_nNodes << std::endl
+            << "BytesPerNode\t" << static_cast<double>(rssAfter - rssBefore) / m_nNodes
+            << std::endl;
+
+  Simulator::Destroy();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::StackBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
@@ -0,0 +1,224 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-trie-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/trie/trie-with-policy.hpp"
+#include "ns3/ndnSIM/utils/trie/lru-policy.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+#include <vector>
+
+// Count bytes allocated with global operator new, to measure memory used by the trie
+
+static size_t g_liveBytes = 0;
+
+static const size_t ALLOCATION_HEADER = alignof(std::max_align_t);
+
+void*
+operator new(size_t size)
+{
+  char* block = static_cast<char*>(std::malloc(size + ALLOCATION_HEADER));
+  if (block == nullptr) {
+    throw std::bad_alloc();
+  }
+  *reinterpret_cast<size_t*>(block) = size;
+  g_liveBytes += size;
+  return block + ALLOCATION_HEADER;
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+  if (ptr == nullptr) {
+    return;
+  }
+  char* block = static_cast<char*>(ptr) - ALLOCATION_HEADER;
+  g_liveBytes -= *reinterpret_cast<size_t*>(block);
+  std::free(block);
+}
+
+void*
+operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void
+operator delete[](void* ptr) noexcept
+{
+  operator delete(ptr);
+}
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * Benchmark of the name trie used by old content stores and FIB/PIT implementations:
+ * memory footprint and insert/lookup/erase throughput.
+ *
+ * Names are /benchmark/<a>/<b>/<i>, where <a> is one of --fanout first-level components
+ * and <b> is one of --fanout second-level components, so that the trie has a few nodes with
+ * many children, and many leaves.  Memory is the number of bytes allocated by the trie
+ * itself (i.e., excluding the names used as keys), divided by the number of entries.
+ *
+ *     ./waf --run "ndn-trie-benchmark --entries=1000000 --fanout=100"
+ */
+class TrieBenchmark {
+public:
+  struct Item {
+  };
+
+  typedef ndnSIM::trie_with_policy<Name, ndnSIM::pointer_payload_traits<Item>,
+                                   ndnSIM::lru_policy_traits> Trie;
+
+  TrieBenchmark()
+    : m_nEntries(1000000)
+    , m_fanout(100)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  void
+  makeNames();
+
+  template<class F>
+  double
+  measure(F f) const
+  {
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    f();
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - begin).count();
+  }
+
+  void
+  print(const std::string& operation, double seconds) const
+  {
+    std::cout << operation << "\t" << m_names.size() << "\t" << seconds << "\t"
+              << (m_names.size() / seconds) << std::endl;
+  }
+
+private:
+  uint32_t m_nEntries;
+  uint32_t m_fanout;
+
+  std::vector<Name> m_names;
+  std::vector<Item> m_items;
+};
+
+void
+TrieBenchmark::makeNames()
+{
+  for (uint32_t i = 0; i < m_nEntries; ++i) {
+    m_names.push_back(Name("/benchmark")
+                        .appendNumber(i % m_fanout)
+                        .appendNumber((i / m_fanout) % m_fanout)
+                        .appendNumber(i));
+    // encode names beforehand, so that the measurements include only the trie
+    m_names.back().wireEncode();
+  }
+  m_items.resize(m_nEntries);
+}
+
+int
+TrieBenchmark::run(int argc, char* argv[])
+{
+#ifdef _DEBUG
+  std::cerr << "Benchmark compiled in debug mode is unreliable, "
+            << "please compile in release mode." << std::endl;
+#endif // _DEBUG
+
+  CommandLine cmd;
+  cmd.AddValue("entries", "Number of entries", m_nEntries);
+  cmd.AddValue("fanout", "Number of distinct components on the first two levels", m_fanout);
+  cmd.Parse(argc, argv);
+
+  makeNames();
+
+  std::vector<uint32_t> order(m_nEntries);
+  for (uint32_t i = 0; i < m_nEntries; ++i) {
+    order[i] = i;
+  }
+  std::shuffle(order.begin(), order.end(), std::mt19937(1));
+
+  Trie trie;
+  trie.getPolicy().set_max_size(m_nEntries);
+
+  std::cout << "Operation\tEntries\tWallTime\tOperationsPerSecond" << std::endl;
+
+  size_t bytesBefore = g_liveBytes;
+  print("Insert", measure([&] {
+          for (uint32_t i : order) {
+            trie.insert(m_names[i], &m_items[i]);
+          }
+        }));
+  size_t trieBytes = g_liveBytes - bytesBefore;
+
+  size_t nFound = 0;
+  std::shuffle(order.begin(), order.end(), std::mt19937(2));
+  print("FindExact", measure([&] {
+          for (uint32_t i : order) {
+            nFound += trie.find_exact(m_names[i]) != trie.end();
+          }
+        }));
+
+  print("LongestPrefixMatch", measure([&] {
+          for (uint32_t i : order) {
+            nFound += trie.longest_prefix_match(m_names[i]) != trie.end();
+          }
+        }));
+
+  std::shuffle(order.begin(), order.end(), std::mt19937(3));
+  print("Erase", measure([&] {
+          for (uint32_t i : order) {
+            trie.erase(m_names[i]);
+          }
+        }));
+
+  if (nFound != 2 * static_cast<size_t>(m_nEntries) || trie.getPolicy().size() != 0) {
+    std::cerr << "Unexpected trie state" << std::endl;
+    return 1;
+  }
+
+  std::cout << std::endl
+            << "TrieBytes\t" << trieBytes << std::endl
+            << "BytesPerEntry\t" << static_cast<double>(trieBytes) / m_nEntries << std::endl;
+  return 0;
+}
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::ndn::TrieBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
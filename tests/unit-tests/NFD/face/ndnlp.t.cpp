@@ -1,43 +1,38 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /**
- * Copyright (c) 2014-2015,  Regents of the University of California,
- *                           Arizona Board of Regents,
- *                           Colorado State University,
- *                           University Pierre & Marie Curie, Sorbonne University,
- *                           Washington University in St. Louis,
- *                           Beijing Institute of Technology,
- *                           The University of Memphis.
+ * Copyright (c) 2011-2015  Regents of the University of California.
  *
- * This file is part of NFD (Named Data Networking Forwarding Daemon).
- * See AUTHORS.md for complete list of NFD authors and contributors.
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
  *
- * NFD is free software: you can redistribute it and/or modify it under the terms
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
  * of the GNU General Public License as published by the Free Software Foundation,
  * either version 3 of the License, or (at your option) any later version.
  *
- * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
  * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
  * PURPOSE.  See the GNU General Public License for more details.
  *
  * You should have received a copy of the GNU General Public License along with
- * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
- */
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
 
-#include "face/ndnlp-sequence-generator.hpp"
-#include "face/ndnlp-slicer.hpp"
-#include "face/ndnlp-partial-message-store.hpp"
 
-#include "tests/test-common.hpp"
+#include "NFD/daemon/face/ndnlp-sequence-generator.hpp"
+#include "NFD/daemon/face/ndnlp-slicer.hpp"
+#include "NFD/daemon/face/ndnlp-partial-message-store.hpp"
 
 #include <boost/scoped_array.hpp>
 
-namespace nfd {
-namespace ndnlp {
-namespace tests {
+#include "../../tests-common.hpp"
 
-using namespace nfd::tests;
+namespace ns3 {
+namespace ndn {
 
-BOOST_FIXTURE_TEST_SUITE(FaceNdnlp, BaseFixture)
+namespace ndnlp = nfd::ndnlp;
+namespace tlv = nfd::tlv;
+
+BOOST_FIXTURE_TEST_SUITE(NfdFaceNdnlp, CleanupFixture)
 
 BOOST_AUTO_TEST_CASE(SequenceBlock)
 {
@@ -74,7 +69,7 @@ BOOST_AUTO_TEST_CASE(Slice1)
 {
   uint8_t blockValue[60];
   memset(blockValue, 0xcc, sizeof(blockValue));
-  Block block = ndn::dataBlock(0x01, blockValue, sizeof(blockValue));
+  Block block = ::ndn::dataBlock(0x01, blockValue, sizeof(blockValue));
 
   ndnlp::Slicer slicer(9000);
   ndnlp::PacketArray pa = slicer.slice(block);
@@ -106,7 +101,7 @@ BOOST_AUTO_TEST_CASE(Slice4)
 {
   uint8_t blockValue[5050];
   memset(blockValue, 0xcc, sizeof(blockValue));
-  Block block = ndn::dataBlock(0x01, blockValue, sizeof(blockValue));
+  Block block = ::ndn::dataBlock(0x01, blockValue, sizeof(blockValue));
 
   ndnlp::Slicer slicer(1500);
   ndnlp::PacketArray pa = slicer.slice(block);
@@ -137,12 +132,12 @@ BOOST_AUTO_TEST_CASE(Slice4)
 
     const Block& fragIndexElement = elements[1];
     BOOST_CHECK_EQUAL(fragIndexElement.type(), static_cast<uint32_t>(tlv::NdnlpFragIndex));
-    uint64_t fragIndex = ndn::readNonNegativeInteger(fragIndexElement);
+    uint64_t fragIndex = ::ndn::readNonNegativeInteger(fragIndexElement);
     BOOST_CHECK_EQUAL(fragIndex, i);
 
     const Block& fragCountElement = elements[2];
     BOOST_CHECK_EQUAL(fragCountElement.type(), static_cast<uint32_t>(tlv::NdnlpFragCount));
-    uint64_t fragCount = ndn::readNonNegativeInteger(fragCountElement);
+    uint64_t fragCount = ::ndn::readNonNegativeInteger(fragCountElement);
     BOOST_CHECK_EQUAL(fragCount, 4);
 
     const Block& payloadElement = elements[3];
@@ -154,12 +149,13 @@ BOOST_AUTO_TEST_CASE(Slice4)
   BOOST_CHECK_EQUAL(totalPayloadSize, block.size());
 }
 
-class ReassembleFixture : protected UnitTestTimeFixture
+class ReassembleFixture : public CleanupFixture
 {
 protected:
-  ReassembleFixture()
+  explicit
+  ReassembleFixture(size_t maxPartialMessages = std::numeric_limits<size_t>::max())
     : slicer(1500)
-    , pms(time::milliseconds(100))
+    , pms(time::milliseconds(100), maxPartialMessages)
   {
     pms.onReceive.connect([this] (const Block& block) {
       received.push_back(block);
@@ -171,7 +167,17 @@ protected:
   {
     boost::scoped_array<uint8_t> blockValue(new uint8_t[valueLength]);
     memset(blockValue.get(), 0xcc, valueLength);
-    return ndn::dataBlock(0x01, blockValue.get(), valueLength);
+    return ::ndn::dataBlock(0x01, blockValue.get(), valueLength);
+  }
+
+  /** \brief runs the simulation for the duration, so that expiry events of partial messages
+   *         are executed
+   */
+  void
+  advanceClocks(const Time& duration)
+  {
+    Simulator::Stop(duration);
+    Simulator::Run();
   }
 
   void
@@ -188,8 +194,6 @@ protected:
   ndnlp::Slicer slicer;
   ndnlp::PartialMessageStore pms;
 
-  static const time::nanoseconds IDLE_DURATION;
-
   // received network layer packets
   std::vector<Block> received;
 };
@@ -223,27 +227,27 @@ BOOST_FIXTURE_TEST_CASE(Reassemble4and2, ReassembleFixture)
   BOOST_CHECK_EQUAL(received.size(), 0);
   this->receiveNdnlpData(pa->at(0));
   BOOST_CHECK_EQUAL(received.size(), 0);
-  this->advanceClocks(time::milliseconds(40));
+  this->advanceClocks(MilliSeconds(40));
 
   this->receiveNdnlpData(pa->at(1));
   BOOST_CHECK_EQUAL(received.size(), 0);
-  this->advanceClocks(time::milliseconds(40));
+  this->advanceClocks(MilliSeconds(40));
 
   this->receiveNdnlpData(pa2->at(1));
   BOOST_CHECK_EQUAL(received.size(), 0);
-  this->advanceClocks(time::milliseconds(40));
+  this->advanceClocks(MilliSeconds(40));
 
   this->receiveNdnlpData(pa->at(1));
   BOOST_CHECK_EQUAL(received.size(), 0);
-  this->advanceClocks(time::milliseconds(40));
+  this->advanceClocks(MilliSeconds(40));
 
   this->receiveNdnlpData(pa2->at(0));
   BOOST_CHECK_EQUAL(received.size(), 1);
-  this->advanceClocks(time::milliseconds(40));
+  this->advanceClocks(MilliSeconds(40));
 
   this->receiveNdnlpData(pa->at(3));
   BOOST_CHECK_EQUAL(received.size(), 1);
-  this->advanceClocks(time::milliseconds(40));
+  this->advanceClocks(MilliSeconds(40));
 
   this->receiveNdnlpData(pa->at(2));
 
@@ -268,39 +272,117 @@ BOOST_FIXTURE_TEST_CASE(ReassembleTimeout, ReassembleFixture)
   BOOST_CHECK_EQUAL(received.size(), 0);
   this->receiveNdnlpData(pa->at(0));
   BOOST_CHECK_EQUAL(received.size(), 0);
-  this->advanceClocks(time::milliseconds(40));
+  this->advanceClocks(MilliSeconds(40));
 
   this->receiveNdnlpData(pa->at(1));
   BOOST_CHECK_EQUAL(received.size(), 0);
-  this->advanceClocks(time::milliseconds(40));
+  this->advanceClocks(MilliSeconds(40));
 
   this->receiveNdnlpData(pa2->at(1));
   BOOST_CHECK_EQUAL(received.size(), 0);
-  this->advanceClocks(time::milliseconds(40));
+  this->advanceClocks(MilliSeconds(40));
 
   this->receiveNdnlpData(pa->at(1));
   BOOST_CHECK_EQUAL(received.size(), 0);
-  this->advanceClocks(time::milliseconds(40));
+  this->advanceClocks(MilliSeconds(40));
 
   this->receiveNdnlpData(pa->at(3));
   BOOST_CHECK_EQUAL(received.size(), 0);
-  this->advanceClocks(time::milliseconds(40));
+  this->advanceClocks(MilliSeconds(40));
 
   this->receiveNdnlpData(pa->at(2));
   BOOST_CHECK_EQUAL(received.size(), 1);
-  this->advanceClocks(time::milliseconds(40));
+  this->advanceClocks(MilliSeconds(40));
 
   this->receiveNdnlpData(pa2->at(0)); // last fragment was received 160ms ago, expired
   BOOST_CHECK_EQUAL(received.size(), 1);
-  this->advanceClocks(time::milliseconds(40));
+  this->advanceClocks(MilliSeconds(40));
 
   BOOST_REQUIRE_EQUAL(received.size(), 1);
   BOOST_CHECK_EQUAL_COLLECTIONS(received.at(0).begin(), received.at(0).end(),
                                 block.begin(),          block.end());
 }
 
+class ReassembleLimitFixture : public ReassembleFixture
+{
+protected:
+  ReassembleLimitFixture()
+    : ReassembleFixture(3)
+  {
+  }
+};
+
+// fragments of new messages are dropped while the store is full
+BOOST_FIXTURE_TEST_CASE(ReassembleLimit, ReassembleLimitFixture)
+{
+  std::vector<Block> blocks;
+  std::vector<ndnlp::PacketArray> pas;
+  for (size_t i = 0; i < 5; ++i) {
+    blocks.push_back(makeBlock(3000 + i));
+    pas.push_back(slicer.slice(blocks.back()));
+    BOOST_REQUIRE_EQUAL(pas.back()->size(), 3);
+  }
+
+  // fill the store
+  this->receiveNdnlpData(pas[0]->at(0));
+  this->receiveNdnlpData(pas[1]->at(0));
+  this->receiveNdnlpData(pas[2]->at(0));
+  BOOST_CHECK_EQUAL(pms.size(), 3);
+
+  // any fragment of a new message is dropped
+  this->receiveNdnlpData(pas[3]->at(0));
+  this->receiveNdnlpData(pas[3]->at(2));
+  BOOST_CHECK_EQUAL(pms.size(), 3);
+
+  // single-fragment messages are not stored
+  Block single = makeBlock(60);
+  this->receiveNdnlpData(slicer.slice(single)->at(0));
+  BOOST_REQUIRE_EQUAL(received.size(), 1);
+  BOOST_CHECK_EQUAL_COLLECTIONS(received.at(0).begin(), received.at(0).end(),
+                                single.begin(),         single.end());
+
+  // fragments of stored messages are accepted
+  this->receiveNdnlpData(pas[0]->at(1));
+  this->receiveNdnlpData(pas[1]->at(2));
+  this->receiveNdnlpData(pas[2]->at(1));
+  BOOST_CHECK_EQUAL(pms.size(), 3);
+  BOOST_CHECK_EQUAL(received.size(), 1);
+
+  this->receiveNdnlpData(pas[0]->at(2));
+  BOOST_CHECK_EQUAL(pms.size(), 2);
+  BOOST_REQUIRE_EQUAL(received.size(), 2);
+  BOOST_CHECK_EQUAL_COLLECTIONS(received.at(1).begin(), received.at(1).end(),
+                                blocks[0].begin(),      blocks[0].end());
+
+  // a new message is accepted after a stored message is reassembled; the dropped fragments
+  // have to be received again
+  this->receiveNdnlpData(pas[3]->at(1));
+  BOOST_CHECK_EQUAL(pms.size(), 3);
+  this->receiveNdnlpData(pas[4]->at(0)); // dropped, the store is full again
+  BOOST_CHECK_EQUAL(pms.size(), 3);
+  this->receiveNdnlpData(pas[3]->at(0));
+  this->receiveNdnlpData(pas[3]->at(2));
+  BOOST_CHECK_EQUAL(pms.size(), 2);
+  BOOST_REQUIRE_EQUAL(received.size(), 3);
+  BOOST_CHECK_EQUAL_COLLECTIONS(received.at(2).begin(), received.at(2).end(),
+                                blocks[3].begin(),      blocks[3].end());
+
+  this->receiveNdnlpData(pas[1]->at(1));
+  this->receiveNdnlpData(pas[4]->at(0));
+  BOOST_CHECK_EQUAL(pms.size(), 2);
+  BOOST_REQUIRE_EQUAL(received.size(), 4);
+  BOOST_CHECK_EQUAL_COLLECTIONS(received.at(3).begin(), received.at(3).end(),
+                                blocks[1].begin(),      blocks[1].end());
+
+  // expired messages free the store
+  this->advanceClocks(MilliSeconds(101));
+  BOOST_CHECK_EQUAL(pms.size(), 0);
+  this->receiveNdnlpData(pas[4]->at(1));
+  BOOST_CHECK_EQUAL(pms.size(), 1);
+  BOOST_CHECK_EQUAL(received.size(), 4);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
-} // namespace tests
-} // namespace ndnlp
-} // namespace nfd
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,202 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "NFD/daemon/fw/load-balance-strategy.hpp"
+#include "NFD/daemon/fw/forwarder.hpp"
+#include "NFD/daemon/fw/retx-suppression-exponential.hpp"
+#include "NFD/tests/daemon/face/dummy-face.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/** \brief a DummyFace with load set by the test
+ */
+class LoadedDummyFace : public nfd::tests::DummyFace
+{
+public:
+  LoadedDummyFace()
+    : queueLength(0)
+    , outRate(0.0)
+  {
+  }
+
+  size_t
+  getQueueLength() const DECL_OVERRIDE
+  {
+    return queueLength;
+  }
+
+  double
+  getOutRate() const DECL_OVERRIDE
+  {
+    return outRate;
+  }
+
+public:
+  size_t queueLength;
+  double outRate;
+};
+
+class LoadBalanceStrategyFixture : public CleanupFixture
+{
+protected:
+  LoadBalanceStrategyFixture()
+    : strategy(forwarder)
+    , face1(make_shared<LoadedDummyFace>())
+    , face2(make_shared<LoadedDummyFace>())
+    , face3(make_shared<LoadedDummyFace>())
+    , face4(make_shared<LoadedDummyFace>())
+  {
+    forwarder.addFace(face1);
+    forwarder.addFace(face2);
+    forwarder.addFace(face3);
+    forwarder.addFace(face4);
+
+    fibEntry = forwarder.getFib().insert(Name()).first;
+    fibEntry->addNextHop(face1, 10);
+    fibEntry->addNextHop(face2, 20);
+    fibEntry->addNextHop(face3, 30);
+  }
+
+  /** \brief receive an Interest from face4
+   *  \return face to which the Interest is forwarded, or nullptr
+   *
+   *  Interests are sent through the forwarder, so the outgoing face is found by the Interest
+   *  it has sent.
+   */
+  shared_ptr<nfd::Face>
+  forwardInterest(const Interest& interest, shared_ptr<nfd::pit::Entry> pitEntry)
+  {
+    std::vector<shared_ptr<LoadedDummyFace>> faces = {face1, face2, face3, face4};
+    for (const auto& face : faces) {
+      face->m_sentInterests.clear();
+    }
+
+    pitEntry->insertOrUpdateInRecord(face4, interest);
+    strategy.afterReceiveInterest(*face4, interest, fibEntry, pitEntry);
+
+    shared_ptr<nfd::Face> outFace;
+    for (const auto& face : faces) {
+      if (!face->m_sentInterests.empty()) {
+        BOOST_CHECK_MESSAGE(outFace == nullptr, "Interest is forwarded to more than one face");
+        outFace = face;
+      }
+    }
+    return outFace;
+  }
+
+  /** \brief receive a new Interest from face4
+   *  \return face to which the Interest is forwarded, or nullptr
+   */
+  shared_ptr<nfd::Face>
+  forwardNewInterest(const Name& name)
+  {
+    shared_ptr<Interest> interest = make_shared<Interest>(name);
+    shared_ptr<nfd::pit::Entry> pitEntry = forwarder.getPit().insert(*interest).first;
+    return forwardInterest(*interest, pitEntry);
+  }
+
+  void
+  advanceClocks(const time::nanoseconds& duration)
+  {
+    Simulator::Stop(NanoSeconds(duration.count()));
+    Simulator::Run();
+  }
+
+protected:
+  StackHelper helper; // ndn-cxx clocks follow simulated time
+  nfd::Forwarder forwarder;
+  nfd::fw::LoadBalanceStrategy strategy;
+  shared_ptr<LoadedDummyFace> face1;
+  shared_ptr<LoadedDummyFace> face2;
+  shared_ptr<LoadedDummyFace> face3;
+  shared_ptr<LoadedDummyFace> face4;
+  shared_ptr<nfd::fib::Entry> fibEntry;
+};
+
+BOOST_FIXTURE_TEST_SUITE(NfdFwLoadBalanceStrategy, LoadBalanceStrategyFixture)
+
+BOOST_AUTO_TEST_CASE(LeastLoaded)
+{
+  // without load, the lowest cost nexthop is used
+  BOOST_CHECK_EQUAL(forwardNewInterest("ndn:/A"), face1);
+
+  // shortest queue
+  face1->queueLength = 5;
+  face2->queueLength = 2;
+  face3->queueLength = 3;
+  BOOST_CHECK_EQUAL(forwardNewInterest("ndn:/B"), face2);
+
+  // same queue length: lowest outgoing rate
+  face3->queueLength = 2;
+  face2->outRate = 2000.0;
+  face3->outRate = 1000.0;
+  BOOST_CHECK_EQUAL(forwardNewInterest("ndn:/C"), face3);
+
+  // same load: lowest cost
+  face2->outRate = 1000.0;
+  BOOST_CHECK_EQUAL(forwardNewInterest("ndn:/D"), face2);
+}
+
+BOOST_AUTO_TEST_CASE(ExcludeDownstream)
+{
+  fibEntry->addNextHop(face4, 5);
+  face1->queueLength = 1;
+  face2->queueLength = 1;
+  face3->queueLength = 1;
+
+  // face4 is the least loaded, but it is downstream
+  BOOST_CHECK_EQUAL(forwardNewInterest("ndn:/A"), face1);
+
+  fibEntry->removeNextHop(face1);
+  fibEntry->removeNextHop(face2);
+  fibEntry->removeNextHop(face3);
+  BOOST_CHECK(forwardNewInterest("ndn:/B") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Retransmit)
+{
+  shared_ptr<Interest> interest = make_shared<Interest>("ndn:/A");
+  shared_ptr<nfd::pit::Entry> pitEntry = forwarder.getPit().insert(*interest).first;
+
+  face1->queueLength = 3;
+  face2->queueLength = 1;
+  face3->queueLength = 2;
+
+  BOOST_CHECK_EQUAL(forwardInterest(*interest, pitEntry), face2);
+
+  // accepted retransmissions go to the least loaded unused nexthop,
+  // then to the nexthop used earliest
+  time::nanoseconds interval = nfd::fw::RetxSuppressionExponential::DEFAULT_MAX_INTERVAL * 2;
+  this->advanceClocks(interval);
+  BOOST_CHECK_EQUAL(forwardInterest(*interest, pitEntry), face3);
+  this->advanceClocks(interval);
+  BOOST_CHECK_EQUAL(forwardInterest(*interest, pitEntry), face1);
+  this->advanceClocks(interval);
+  BOOST_CHECK_EQUAL(forwardInterest(*interest, pitEntry), face2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
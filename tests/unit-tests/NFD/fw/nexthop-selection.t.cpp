@@ -0,0 +1,223 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "NFD/daemon/fw/nexthop-selection.hpp"
+#include "NFD/daemon/fw/forwarder.hpp"
+#include "NFD/tests/daemon/face/dummy-face.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include <random>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::fib::NextHopList;
+
+BOOST_FIXTURE_TEST_SUITE(NfdFwNextHopSelection, CleanupFixture)
+
+/** \brief PIT entry and FIB nexthops with random InRecords, OutRecords and scope
+ */
+struct Scenario
+{
+  shared_ptr<Interest> interest;
+  shared_ptr<nfd::pit::Entry> pitEntry;
+  shared_ptr<nfd::fib::Entry> fibEntry;
+  nfd::FaceId downstream;
+};
+
+/** \brief position of \p it in \p nexthops, for readable test output
+ */
+static ptrdiff_t
+position(const NextHopList& nexthops, NextHopList::const_iterator it)
+{
+  return std::distance(nexthops.begin(), it);
+}
+
+static void
+checkSelection(const Scenario& scenario)
+{
+  const nfd::pit::Entry& pitEntry = *scenario.pitEntry;
+  const NextHopList& nexthops = scenario.fibEntry->getNextHops();
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  nfd::fw::NextHopSelection selection(pitEntry, nexthops, scenario.downstream, now);
+
+  auto isEligible = [&] (const nfd::fib::NextHop& nexthop) {
+    return nexthop.getFace()->getId() != scenario.downstream &&
+           !pitEntry.violatesScope(*nexthop.getFace());
+  };
+  auto hasUnexpiredOutRecord = [&] (const nfd::fib::NextHop& nexthop) {
+    auto outRecord = pitEntry.getOutRecord(*nexthop.getFace());
+    return outRecord != pitEntry.getOutRecords().end() && outRecord->getExpiry() > now;
+  };
+
+  auto forwardable = std::find_if(nexthops.begin(), nexthops.end(),
+    [&] (const nfd::fib::NextHop& nexthop) { return pitEntry.canForwardTo(*nexthop.getFace()); });
+  BOOST_CHECK_EQUAL(position(nexthops, selection.getFirstForwardable()),
+                    position(nexthops, forwardable));
+
+  auto eligible = std::find_if(nexthops.begin(), nexthops.end(), isEligible);
+  BOOST_CHECK_EQUAL(position(nexthops, selection.getFirstEligible()),
+                    position(nexthops, eligible));
+
+  auto unused = std::find_if(nexthops.begin(), nexthops.end(),
+    [&] (const nfd::fib::NextHop& nexthop) {
+      return isEligible(nexthop) && !hasUnexpiredOutRecord(nexthop);
+    });
+  BOOST_CHECK_EQUAL(position(nexthops, selection.getFirstUnused()),
+                    position(nexthops, unused));
+
+  // all OutRecords were renewed at the same time, so the first one is the earliest
+  auto earliest = std::find_if(nexthops.begin(), nexthops.end(),
+    [&] (const nfd::fib::NextHop& nexthop) {
+      return isEligible(nexthop) &&
+             pitEntry.getOutRecord(*nexthop.getFace()) != pitEntry.getOutRecords().end();
+    });
+  BOOST_CHECK_EQUAL(position(nexthops, selection.getEarliestOutRecord()),
+                    position(nexthops, earliest));
+}
+
+/** \brief a NextHopSelection::Preference that does not follow the cost order
+ */
+static bool
+hasHigherFaceId(const nfd::fib::NextHop& a, const nfd::fib::NextHop& b)
+{
+  return a.getFace()->getId() > b.getFace()->getId();
+}
+
+/** \brief checks that a preference selects the most preferred qualifying nexthop,
+ *         and the lowest-cost one among equally preferred
+ */
+static void
+checkSelectionWithPreference(const Scenario& scenario)
+{
+  const nfd::pit::Entry& pitEntry = *scenario.pitEntry;
+  const NextHopList& nexthops = scenario.fibEntry->getNextHops();
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  nfd::fw::NextHopSelection selection(pitEntry, nexthops, scenario.downstream, now,
+                                      &hasHigherFaceId);
+  nfd::fw::NextHopSelection costOrder(pitEntry, nexthops, scenario.downstream, now);
+
+  auto findPreferred = [&] (const std::function<bool(const nfd::fib::NextHop&)>& qualifies) {
+    auto preferred = nexthops.end();
+    for (auto it = nexthops.begin(); it != nexthops.end(); ++it) {
+      if (qualifies(*it) && (preferred == nexthops.end() || hasHigherFaceId(*it, *preferred))) {
+        preferred = it;
+      }
+    }
+    return preferred;
+  };
+  auto isEligible = [&] (const nfd::fib::NextHop& nexthop) {
+    return nexthop.getFace()->getId() != scenario.downstream &&
+           !pitEntry.violatesScope(*nexthop.getFace());
+  };
+  auto isUnused = [&] (const nfd::fib::NextHop& nexthop) {
+    auto outRecord = pitEntry.getOutRecord(*nexthop.getFace());
+    return isEligible(nexthop) &&
+           !(outRecord != pitEntry.getOutRecords().end() && outRecord->getExpiry() > now);
+  };
+  auto isForwardable = [&] (const nfd::fib::NextHop& nexthop) {
+    return pitEntry.canForwardTo(*nexthop.getFace());
+  };
+
+  BOOST_CHECK_EQUAL(position(nexthops, selection.getFirstForwardable()),
+                    position(nexthops, findPreferred(isForwardable)));
+  BOOST_CHECK_EQUAL(position(nexthops, selection.getFirstEligible()),
+                    position(nexthops, findPreferred(isEligible)));
+  BOOST_CHECK_EQUAL(position(nexthops, selection.getFirstUnused()),
+                    position(nexthops, findPreferred(isUnused)));
+
+  // preference does not apply to the earliest OutRecord
+  BOOST_CHECK_EQUAL(position(nexthops, selection.getEarliestOutRecord()),
+                    position(nexthops, costOrder.getEarliestOutRecord()));
+}
+
+static void
+checkSelections(const std::vector<Scenario>* scenarios)
+{
+  for (const Scenario& scenario : *scenarios) {
+    checkSelection(scenario);
+    checkSelectionWithPreference(scenario);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SameAsCanForwardTo)
+{
+  StackHelper helper; // ndn-cxx clocks follow simulated time
+
+  nfd::Forwarder forwarder;
+  std::vector<shared_ptr<nfd::Face>> faces;
+  for (int i = 0; i < 3; ++i) {
+    faces.push_back(make_shared<nfd::tests::DummyFace>());
+    faces.push_back(make_shared<nfd::tests::DummyLocalFace>());
+  }
+  for (const auto& face : faces) {
+    forwarder.addFace(face);
+  }
+
+  // records are created at time 0 and checked at 1s, when they are expired, expire right now,
+  // or are not expired
+  const time::milliseconds lifetimes[] = {time::milliseconds(500), time::milliseconds(1000),
+                                          time::milliseconds(4000)};
+  const Name names[] = {"/A", "/localhost/A", "/localhop/A"};
+
+  std::mt19937 generator(1);
+  auto random = [&generator] (int n) {
+    return std::uniform_int_distribution<int>(0, n - 1)(generator);
+  };
+
+  std::vector<Scenario> scenarios(1000);
+  for (Scenario& scenario : scenarios) {
+    scenario.interest = make_shared<Interest>(names[random(3)]);
+    scenario.pitEntry = make_shared<nfd::pit::Entry>(*scenario.interest);
+    scenario.fibEntry = make_shared<nfd::fib::Entry>(scenario.interest->getName());
+
+    for (const auto& face : faces) {
+      int inRecord = random(4);
+      if (inRecord > 0) {
+        auto interest = make_shared<Interest>(scenario.interest->getName());
+        interest->setInterestLifetime(lifetimes[inRecord - 1]);
+        scenario.pitEntry->insertOrUpdateInRecord(face, *interest);
+      }
+      int outRecord = random(4);
+      if (outRecord > 0) {
+        auto interest = make_shared<Interest>(scenario.interest->getName());
+        interest->setInterestLifetime(lifetimes[outRecord - 1]);
+        scenario.pitEntry->insertOrUpdateOutRecord(face, *interest);
+      }
+      if (random(3) > 0) {
+        scenario.fibEntry->addNextHop(face, random(4));
+      }
+    }
+
+    int downstream = random(faces.size() + 1);
+    scenario.downstream = downstream < static_cast<int>(faces.size()) ?
+                          faces[downstream]->getId() : nfd::INVALID_FACEID;
+  }
+
+  Simulator::Schedule(Seconds(1), &checkSelections, &scenarios);
+  Simulator::Run();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
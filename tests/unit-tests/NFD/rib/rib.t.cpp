@@ -0,0 +1,335 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "NFD/rib/rib.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::rib::Rib;
+using nfd::rib::RibEntry;
+using nfd::rib::RibUpdate;
+using nfd::rib::Route;
+using ::ndn::nfd::ROUTE_FLAG_CHILD_INHERIT;
+using ::ndn::nfd::ROUTE_FLAG_CAPTURE;
+
+BOOST_AUTO_TEST_SUITE(NfdRibRib)
+
+static Route
+makeRoute(uint64_t faceId, uint64_t flags)
+{
+  Route route;
+  route.faceId = faceId;
+  route.origin = 0;
+  route.cost = faceId;
+  route.flags = flags;
+  return route;
+}
+
+/** \brief erases a route as the RIB does after FibUpdater has succeeded
+ */
+static void
+eraseRoute(Rib& rib, const Name& name, const Route& route)
+{
+  RibUpdate update;
+  update.setAction(RibUpdate::UNREGISTER)
+        .setName(name)
+        .setRoute(route);
+
+  nfd::rib::RibUpdateBatch batch(route.faceId);
+  batch.add(update);
+  rib.onFibUpdateSuccess(batch, nfd::rib::RibUpdateList(), nullptr);
+}
+
+static bool
+compareFaceIds(const Route& lhs, const Route& rhs)
+{
+  return lhs.faceId < rhs.faceId;
+}
+
+static std::vector<uint64_t>
+getFaceIds(const Rib::RouteSet& routes)
+{
+  std::vector<uint64_t> faceIds;
+  for (const Route& route : routes) {
+    faceIds.push_back(route.faceId);
+  }
+  return faceIds;
+}
+
+static std::vector<std::string>
+toStrings(const Rib::RouteSet& routes)
+{
+  std::vector<std::string> strings;
+  for (const Route& route : routes) {
+    strings.push_back("faceid " + std::to_string(route.faceId) +
+                      " origin " + std::to_string(route.origin) +
+                      " cost " + std::to_string(route.cost) +
+                      " flags " + std::to_string(route.flags));
+  }
+  return strings;
+}
+
+/** \brief computes inherited routes by walking all ancestors, as the RIB did without the cache
+ */
+static Rib::RouteSet
+walkAncestorRoutes(const Rib& rib, const Name& name)
+{
+  Rib::RouteSet routes(&compareFaceIds);
+
+  for (shared_ptr<RibEntry> parent = rib.findParent(name); parent != nullptr;
+       parent = parent->getParent()) {
+    // routes of nearer ancestors take precedence over routes with the same face ID
+    for (const Route& route : *parent) {
+      if (route.isChildInherit()) {
+        routes.insert(route);
+      }
+    }
+
+    if (parent->hasCapture()) {
+      break;
+    }
+  }
+
+  return routes;
+}
+
+/** \brief checks that a cached set on an entry implies a cached set on its parent
+ */
+static void
+checkCachedParents(const Rib& rib)
+{
+  for (const auto& item : rib) {
+    const RibEntry& entry = *item.second;
+    if (rib.hasCachedRoutesForChildren(entry) && entry.getParent() != nullptr) {
+      BOOST_CHECK_MESSAGE(rib.hasCachedRoutesForChildren(*entry.getParent()),
+                          entry.getName() << " is cached, but its parent is not");
+    }
+  }
+}
+
+/** \brief checks that routes inherited from the cache are the same as routes found by walking
+ *         the ancestors, for every entry and for the passed names not in the RIB
+ */
+static void
+checkAncestorRoutes(const Rib& rib, const std::vector<Name>& otherNames = {})
+{
+  // sets left by the previous check must have been invalidated consistently
+  checkCachedParents(rib);
+
+  std::vector<Name> names = otherNames;
+  for (const auto& item : rib) {
+    names.push_back(item.first);
+  }
+
+  for (const Name& name : names) {
+    BOOST_TEST_MESSAGE("getAncestorRoutes(" << name << ")");
+    std::vector<std::string> cached = toStrings(rib.getAncestorRoutes(name));
+    std::vector<std::string> walked = toStrings(walkAncestorRoutes(rib, name));
+    BOOST_CHECK_EQUAL_COLLECTIONS(cached.begin(), cached.end(), walked.begin(), walked.end());
+  }
+
+  checkCachedParents(rib);
+}
+
+static std::vector<Name>
+getNames(const Rib::RibEntryList& entries)
+{
+  std::vector<Name> names;
+  for (const shared_ptr<RibEntry>& entry : entries) {
+    names.push_back(entry->getName());
+  }
+  return names;
+}
+
+BOOST_AUTO_TEST_CASE(FindChildren)
+{
+  Rib rib;
+
+  Route route = makeRoute(1, 0);
+  rib.insert("/a", route);
+  rib.insert("/a/b/c", route);
+  rib.insert("/a/b/c/d", route);
+  rib.insert("/a/b/c/d/e", route);
+  rib.insert("/a/b/e", route);
+  rib.insert("/a/f/g", route);
+  rib.insert("/b", route);
+
+  Rib::RibEntryList children = rib.findChildren("/a/b");
+  BOOST_REQUIRE_EQUAL(children.size(), 2);
+  BOOST_CHECK_EQUAL(children.front()->getName(), "/a/b/c");
+  BOOST_CHECK_EQUAL(children.back()->getName(), "/a/b/e");
+
+  BOOST_CHECK_EQUAL(rib.findChildren("/a").size(), 3);
+  BOOST_CHECK_EQUAL(rib.findChildren("/").size(), 2);
+  BOOST_CHECK_EQUAL(rib.findChildren("/a/b/c/d/e").size(), 0);
+  BOOST_CHECK_EQUAL(rib.findDescendantsForNonInsertedName("/a/b").size(), 4);
+
+  // "/a/b/d" is the successor of "/a/b/c"; "/a/b/ca" and "/a/b/c0" are ordered after it
+  rib.insert("/a/b/d", route);
+  rib.insert("/a/b/ca", route);
+  rib.insert("/a/b/ca/x", route);
+  rib.insert("/a/b/c0", route);
+  std::vector<Name> expected = {"/a/b/c", "/a/b/d", "/a/b/e", "/a/b/c0", "/a/b/ca"};
+  std::vector<Name> actual = getNames(rib.findChildren("/a/b"));
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+
+  // "/a/b" adopts the children
+  rib.insert("/a/b", route);
+  BOOST_CHECK_EQUAL(rib.find("/a/b")->second->getChildren().size(), 5);
+  BOOST_CHECK_EQUAL(rib.find("/a")->second->getChildren().size(), 2);
+  BOOST_CHECK(rib.find("/a/b/c")->second->getParent() == rib.find("/a/b")->second);
+  BOOST_CHECK(rib.find("/a/b/c/d")->second->getParent() == rib.find("/a/b/c")->second);
+  BOOST_CHECK(rib.find("/a/b/ca/x")->second->getParent() == rib.find("/a/b/ca")->second);
+}
+
+BOOST_AUTO_TEST_CASE(InsertBetweenParentAndChildren)
+{
+  Rib rib;
+  rib.insert("/a", makeRoute(1, ROUTE_FLAG_CHILD_INHERIT));
+  rib.insert("/a/b/c", makeRoute(3, ROUTE_FLAG_CHILD_INHERIT));
+  rib.insert("/a/b/d", makeRoute(4, 0));
+  rib.insert("/a/b/d/e", makeRoute(5, 0));
+  checkAncestorRoutes(rib, {"/a/b", "/a/b/c/x"});
+  BOOST_CHECK(rib.hasCachedRoutesForChildren(*rib.find("/a/b/d")->second));
+
+  rib.insert("/a/b", makeRoute(2, ROUTE_FLAG_CHILD_INHERIT));
+  BOOST_CHECK(!rib.hasCachedRoutesForChildren(*rib.find("/a/b/c")->second));
+  BOOST_CHECK(!rib.hasCachedRoutesForChildren(*rib.find("/a/b/d")->second));
+  BOOST_CHECK(!rib.hasCachedRoutesForChildren(*rib.find("/a/b/d/e")->second));
+  checkAncestorRoutes(rib, {"/a/b/c/x"});
+
+  std::vector<uint64_t> expected = {1, 2};
+  std::vector<uint64_t> actual = getFaceIds(rib.getAncestorRoutes("/a/b/d/e"));
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+
+  expected = {1, 2, 3};
+  actual = getFaceIds(rib.getAncestorRoutes("/a/b/c/x"));
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+
+  // a new root entry
+  rib.insert("/", makeRoute(6, ROUTE_FLAG_CHILD_INHERIT));
+  checkAncestorRoutes(rib, {"/x"});
+
+  expected = {1, 2, 6};
+  actual = getFaceIds(rib.getAncestorRoutes("/a/b/d/e"));
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(ChangeFlags)
+{
+  Rib rib;
+  rib.insert("/", makeRoute(1, ROUTE_FLAG_CHILD_INHERIT));
+  rib.insert("/a", makeRoute(2, ROUTE_FLAG_CHILD_INHERIT));
+  rib.insert("/a/b", makeRoute(3, 0));
+  rib.insert("/a/b/c", makeRoute(4, ROUTE_FLAG_CHILD_INHERIT));
+  rib.insert("/a/b/c/d", makeRoute(5, 0));
+  rib.insert("/e", makeRoute(6, 0));
+  rib.insert("/e/f", makeRoute(8, 0));
+  checkAncestorRoutes(rib);
+
+  // CAPTURE on "/a/b" stops routes of "/" and "/a"
+  rib.insert("/a/b", makeRoute(3, ROUTE_FLAG_CAPTURE));
+  BOOST_CHECK(rib.hasCachedRoutesForChildren(*rib.find("/a")->second));
+  BOOST_CHECK(rib.hasCachedRoutesForChildren(*rib.find("/e")->second));
+  checkAncestorRoutes(rib);
+
+  std::vector<uint64_t> expected = {4};
+  std::vector<uint64_t> actual = getFaceIds(rib.getAncestorRoutes("/a/b/c/d"));
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+
+  // CHILD_INHERIT and CAPTURE on "/a/b"
+  rib.insert("/a/b", makeRoute(3, ROUTE_FLAG_CHILD_INHERIT | ROUTE_FLAG_CAPTURE));
+  checkAncestorRoutes(rib);
+
+  expected = {3, 4};
+  actual = getFaceIds(rib.getAncestorRoutes("/a/b/c/d"));
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+
+  // clearing the flags of "/a/b" brings back routes of "/" and "/a"
+  rib.insert("/a/b", makeRoute(3, 0));
+  checkAncestorRoutes(rib);
+
+  expected = {1, 2, 4};
+  actual = getFaceIds(rib.getAncestorRoutes("/a/b/c/d"));
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+
+  // clearing CHILD_INHERIT on the root affects every entry
+  rib.insert("/", makeRoute(1, 0));
+  BOOST_CHECK(!rib.hasCachedRoutesForChildren(*rib.find("/e")->second));
+  checkAncestorRoutes(rib);
+
+  expected = {2, 4};
+  actual = getFaceIds(rib.getAncestorRoutes("/a/b/c/d"));
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+
+  // a route on another face of "/a/b/c" with CAPTURE
+  rib.insert("/a/b/c", makeRoute(7, ROUTE_FLAG_CAPTURE));
+  checkAncestorRoutes(rib);
+
+  expected = {4};
+  actual = getFaceIds(rib.getAncestorRoutes("/a/b/c/d"));
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(EraseMiddleEntry)
+{
+  Rib rib;
+  rib.insert("/a", makeRoute(1, ROUTE_FLAG_CHILD_INHERIT));
+  rib.insert("/a/b", makeRoute(2, ROUTE_FLAG_CHILD_INHERIT | ROUTE_FLAG_CAPTURE));
+  rib.insert("/a/b", makeRoute(3, ROUTE_FLAG_CHILD_INHERIT));
+  rib.insert("/a/b/c", makeRoute(4, 0));
+  rib.insert("/a/b/c/d", makeRoute(5, 0));
+  rib.insert("/a/b/e", makeRoute(6, 0));
+  checkAncestorRoutes(rib, {"/a/b/x"});
+
+  // removing the CAPTURE route keeps the entry
+  eraseRoute(rib, "/a/b", makeRoute(2, 0));
+  BOOST_REQUIRE(rib.find("/a/b") != rib.end());
+  checkAncestorRoutes(rib, {"/a/b/x"});
+
+  std::vector<uint64_t> expected = {1, 3};
+  std::vector<uint64_t> actual = getFaceIds(rib.getAncestorRoutes("/a/b/c/d"));
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+
+  // removing the last route erases the entry, and its children move to "/a"
+  eraseRoute(rib, "/a/b", makeRoute(3, 0));
+  BOOST_REQUIRE(rib.find("/a/b") == rib.end());
+  BOOST_CHECK(rib.find("/a/b/c")->second->getParent() == rib.find("/a")->second);
+  BOOST_CHECK(!rib.hasCachedRoutesForChildren(*rib.find("/a/b/c")->second));
+  checkAncestorRoutes(rib, {"/a/b/x"});
+
+  expected = {1};
+  actual = getFaceIds(rib.getAncestorRoutes("/a/b/c/d"));
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+
+  // erasing the root of the tree
+  eraseRoute(rib, "/a", makeRoute(1, 0));
+  BOOST_CHECK(rib.find("/a/b/c")->second->getParent() == nullptr);
+  checkAncestorRoutes(rib, {"/a/b/x"});
+  BOOST_CHECK_EQUAL(rib.getAncestorRoutes("/a/b/c/d").size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
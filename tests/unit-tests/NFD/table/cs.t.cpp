@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "ns3/ndnSIM/NFD/daemon/table/cs.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include <ndn-cxx/util/crypto.hpp>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(NfdTableCs, CleanupFixture)
+
+static Block
+makeDataWire(const Name& name, uint32_t id)
+{
+  Data data(name);
+  data.setContent(reinterpret_cast<const uint8_t*>(&id), sizeof(id));
+  StackHelper::getKeyChain().sign(data);
+  return data.wireEncode();
+}
+
+/** \brief Data packet whose wire encoding lives in a buffer that the test can modify
+ *
+ *  Data::getFullName caches the implicit digest, so after the buffer is modified,
+ *  getFullName returns the digest of the modified wire only if it was not computed before.
+ */
+class DataWithBuffer
+{
+public:
+  explicit
+  DataWithBuffer(const Block& wire)
+    : buffer(make_shared< ::ndn::Buffer>(wire.wire(), wire.size()))
+    , data(make_shared<Data>(Block(buffer)))
+  {
+  }
+
+  /** \brief modify the last octet of SignatureValue
+   *  \return full Name of the modified packet
+   */
+  Name
+  modify()
+  {
+    buffer->back() ^= 0xFF;
+    Name fullName = data->getName();
+    fullName.appendImplicitSha256Digest(::ndn::crypto::sha256(buffer->buf(), buffer->size()));
+    return fullName;
+  }
+
+public:
+  shared_ptr< ::ndn::Buffer> buffer;
+  shared_ptr<Data> data;
+};
+
+BOOST_AUTO_TEST_CASE(InsertWithoutDigest)
+{
+  nfd::Cs cs;
+
+  DataWithBuffer data1(makeDataWire("/A", 1));
+  cs.insert(*data1.data);
+
+  // another copy of the same packet refreshes the existing entry
+  DataWithBuffer data1copy(data1.data->wireEncode());
+  cs.insert(*data1copy.data);
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+
+  // a different packet with the same Name is a separate entry
+  DataWithBuffer data2(makeDataWire("/A", 2));
+  cs.insert(*data2.data);
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+
+  DataWithBuffer data2copy(data2.data->wireEncode());
+  cs.insert(*data2copy.data);
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+
+  // none of the inserted copies had its digest computed
+  // (data1 and data2 are left alone because modifying them would reorder the Cs)
+  Name fullName1 = data1copy.modify();
+  BOOST_CHECK_EQUAL(data1copy.data->getFullName(), fullName1);
+  Name fullName2 = data2copy.modify();
+  BOOST_CHECK_EQUAL(data2copy.data->getFullName(), fullName2);
+}
+
+BOOST_AUTO_TEST_CASE(FindFullName)
+{
+  nfd::Cs cs;
+
+  DataWithBuffer data1(makeDataWire("/A", 1));
+  DataWithBuffer data2(makeDataWire("/A", 2));
+  DataWithBuffer data3(makeDataWire("/A/B", 3));
+  cs.insert(*data1.data);
+  cs.insert(*data2.data);
+  cs.insert(*data3.data);
+
+  for (const DataWithBuffer* expected : {&data1, &data2, &data3}) {
+    for (int childSelector : {0, 1}) {
+      Interest interest(expected->data->getFullName());
+      interest.setChildSelector(childSelector);
+
+      bool hasFound = false;
+      cs.find(interest,
+              [&] (const Interest&, const Data& found) {
+                hasFound = true;
+                BOOST_CHECK(found.wireEncode() == expected->data->wireEncode());
+              },
+              [] (const Interest&) { BOOST_CHECK(false); });
+      BOOST_CHECK(hasFound);
+    }
+  }
+
+  // a full Name with a digest that matches no stored packet
+  Name unknown("/A");
+  unknown.appendImplicitSha256Digest(::ndn::crypto::sha256(data3.buffer->buf(), 1));
+  bool hasMissed = false;
+  cs.find(Interest(unknown),
+          [] (const Interest&, const Data&) { BOOST_CHECK(false); },
+          [&] (const Interest&) { hasMissed = true; });
+  BOOST_CHECK(hasMissed);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
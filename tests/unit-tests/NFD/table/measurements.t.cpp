@@ -0,0 +1,333 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "NFD/daemon/table/measurements.hpp"
+#include "NFD/daemon/table/pit.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::NameTree;
+using nfd::Measurements;
+
+BOOST_FIXTURE_TEST_SUITE(NfdTableMeasurements, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Get_Parent)
+{
+  NameTree nameTree;
+  Measurements measurements(nameTree);
+
+  Name name0;
+  Name nameA ("ndn:/A");
+  Name nameAB("ndn:/A/B");
+
+  shared_ptr<nfd::measurements::Entry> entryAB = measurements.get(nameAB);
+  BOOST_REQUIRE(entryAB != nullptr);
+  BOOST_CHECK_EQUAL(entryAB->getName(), nameAB);
+
+  shared_ptr<nfd::measurements::Entry> entry0 = measurements.get(name0);
+  BOOST_REQUIRE(entry0 != nullptr);
+
+  shared_ptr<nfd::measurements::Entry> entryA = measurements.getParent(*entryAB);
+  BOOST_REQUIRE(entryA != nullptr);
+  BOOST_CHECK_EQUAL(entryA->getName(), nameA);
+
+  shared_ptr<nfd::measurements::Entry> entry0c = measurements.getParent(*entryA);
+  BOOST_CHECK_EQUAL(entry0, entry0c);
+}
+
+class DummyStrategyInfo1 : public nfd::fw::StrategyInfo
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 21;
+  }
+};
+
+class DummyStrategyInfo2 : public nfd::fw::StrategyInfo
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 22;
+  }
+};
+
+BOOST_AUTO_TEST_CASE(FindLongestPrefixMatch)
+{
+  NameTree nameTree;
+  Measurements measurements(nameTree);
+
+  measurements.get("/A");
+  measurements.get("/A/B/C")->getOrCreateStrategyInfo<DummyStrategyInfo1>();
+  measurements.get("/A/B/C/D");
+
+  shared_ptr<nfd::measurements::Entry> found1 = measurements.findLongestPrefixMatch("/A/B/C/D/E");
+  BOOST_REQUIRE(found1 != nullptr);
+  BOOST_CHECK_EQUAL(found1->getName(), "/A/B/C/D");
+
+  shared_ptr<nfd::measurements::Entry> found2 = measurements.findLongestPrefixMatch("/A/B/C/D/E",
+      nfd::measurements::EntryWithStrategyInfo<DummyStrategyInfo1>());
+  BOOST_REQUIRE(found2 != nullptr);
+  BOOST_CHECK_EQUAL(found2->getName(), "/A/B/C");
+
+  shared_ptr<nfd::measurements::Entry> found3 = measurements.findLongestPrefixMatch("/A/B/C/D/E",
+      nfd::measurements::EntryWithStrategyInfo<DummyStrategyInfo2>());
+  BOOST_CHECK(found3 == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(FindLongestPrefixMatchWithPitEntry)
+{
+  NameTree nameTree;
+  Measurements measurements(nameTree);
+  nfd::Pit pit(nameTree);
+
+  measurements.get("/A");
+  measurements.get("/A/B/C")->getOrCreateStrategyInfo<DummyStrategyInfo1>();
+  measurements.get("/A/B/C/D");
+
+  shared_ptr<Interest> interest = make_shared<Interest>("/A/B/C/D/E");
+  shared_ptr<nfd::pit::Entry> pitEntry = pit.insert(*interest).first;
+
+  shared_ptr<nfd::measurements::Entry> found1 = measurements.findLongestPrefixMatch(*pitEntry);
+  BOOST_REQUIRE(found1 != nullptr);
+  BOOST_CHECK_EQUAL(found1->getName(), "/A/B/C/D");
+
+  shared_ptr<nfd::measurements::Entry> found2 = measurements.findLongestPrefixMatch(*pitEntry,
+      nfd::measurements::EntryWithStrategyInfo<DummyStrategyInfo1>());
+  BOOST_REQUIRE(found2 != nullptr);
+  BOOST_CHECK_EQUAL(found2->getName(), "/A/B/C");
+
+  shared_ptr<nfd::measurements::Entry> found3 = measurements.findLongestPrefixMatch(*pitEntry,
+      nfd::measurements::EntryWithStrategyInfo<DummyStrategyInfo2>());
+  BOOST_CHECK(found3 == nullptr);
+}
+
+static void
+checkEntry(const Measurements* measurements, const Name& name, bool shouldExist)
+{
+  bool exists = measurements->findExactMatch(name) != nullptr;
+  BOOST_CHECK_MESSAGE(exists == shouldExist,
+                      name << (shouldExist ? " should exist" : " should be removed")
+                      << " at " << Simulator::Now().GetMicroSeconds() << "us");
+}
+
+static void
+checkSize(const Measurements* measurements, size_t size)
+{
+  BOOST_CHECK_EQUAL(measurements->size(), size);
+}
+
+static void
+extendLifetime(Measurements* measurements, const Name& name, time::nanoseconds lifetime)
+{
+  measurements->extendLifetime(*measurements->get(name), lifetime);
+}
+
+BOOST_AUTO_TEST_CASE(Lifetime)
+{
+  StackHelper helper; // ndn-cxx clocks follow simulated time
+
+  NameTree nameTree;
+  Measurements measurements(nameTree);
+  Name nameA("ndn:/A");
+  Name nameB("ndn:/B");
+  Name nameC("ndn:/C");
+
+  BOOST_CHECK_EQUAL(measurements.size(), 0);
+
+  shared_ptr<nfd::measurements::Entry> entryA = measurements.get(nameA);
+  shared_ptr<nfd::measurements::Entry> entryB = measurements.get(nameB);
+  shared_ptr<nfd::measurements::Entry> entryC = measurements.get(nameC);
+  BOOST_CHECK_EQUAL(measurements.size(), 3);
+
+  // A is extended by less than its remaining lifetime, which does not shorten it;
+  // C is extended past the initial lifetime, so the sweep at 4s must keep it
+  measurements.extendLifetime(*entryA, time::seconds(2));
+  measurements.extendLifetime(*entryC, time::seconds(6));
+  entryA.reset();
+  entryB.reset();
+  entryC.reset();
+
+  Simulator::Schedule(Seconds(3), &checkSize, &measurements, 3);
+
+  Simulator::Schedule(Seconds(5), &checkEntry, &measurements, nameA, false);
+  Simulator::Schedule(Seconds(5), &checkEntry, &measurements, nameB, false);
+  Simulator::Schedule(Seconds(5), &checkEntry, &measurements, nameC, true);
+  Simulator::Schedule(Seconds(5), &checkSize, &measurements, 1);
+
+  Simulator::Schedule(Seconds(7), &checkEntry, &measurements, nameC, false);
+  Simulator::Schedule(Seconds(7), &checkSize, &measurements, 0);
+
+  Simulator::Stop(Seconds(10));
+  Simulator::Run();
+}
+
+BOOST_AUTO_TEST_CASE(LifetimeExtendedRepeatedly)
+{
+  StackHelper helper;
+
+  NameTree nameTree;
+  Measurements measurements(nameTree);
+  Name nameA("ndn:/A");
+  Name nameB("ndn:/B");
+
+  measurements.get(nameB);
+  for (int i = 0; i < 100; ++i) {
+    Simulator::Schedule(MilliSeconds(100 * i), &extendLifetime, &measurements, nameA,
+                        time::seconds(5));
+  }
+
+  // A is extended until 14.9s, B expires at 4s; every extension after the first leaves
+  // A's record in the queue with a stale expiry time
+  Simulator::Schedule(Seconds(10), &checkEntry, &measurements, nameA, true);
+  Simulator::Schedule(Seconds(10), &checkEntry, &measurements, nameB, false);
+  Simulator::Schedule(Seconds(10), &checkSize, &measurements, 1);
+
+  Simulator::Schedule(Seconds(14.8), &checkEntry, &measurements, nameA, true);
+  Simulator::Schedule(Seconds(15), &checkEntry, &measurements, nameA, false);
+  Simulator::Schedule(Seconds(15), &checkSize, &measurements, 0);
+
+  Simulator::Stop(Seconds(20));
+  Simulator::Run();
+}
+
+BOOST_AUTO_TEST_CASE(LifetimeExtendedAfterRequeue)
+{
+  StackHelper helper;
+
+  NameTree nameTree;
+  Measurements measurements(nameTree);
+  Name nameA("ndn:/A");
+
+  measurements.get(nameA);
+  // queued at 4s, requeued at 6s by the first sweep, and at 9s by the second one
+  Simulator::Schedule(Seconds(1), &extendLifetime, &measurements, nameA, time::seconds(5));
+  Simulator::Schedule(Seconds(5), &extendLifetime, &measurements, nameA, time::seconds(4));
+
+  Simulator::Schedule(Seconds(4.5), &checkEntry, &measurements, nameA, true);
+  Simulator::Schedule(Seconds(8.9), &checkEntry, &measurements, nameA, true);
+  Simulator::Schedule(Seconds(9.1), &checkEntry, &measurements, nameA, false);
+
+  Simulator::Stop(Seconds(10));
+  Simulator::Run();
+}
+
+BOOST_AUTO_TEST_CASE(SweepInterval)
+{
+  StackHelper helper;
+
+  NameTree nameTree;
+  Measurements measurements(nameTree);
+  Name nameA("ndn:/A");
+  Name nameB("ndn:/B");
+
+  BOOST_REQUIRE_EQUAL(Measurements::getSweepInterval(), time::milliseconds(5));
+
+  // A expires at 4s and B at 4.002s, but there is no sweep between 4s and 4.005s
+  measurements.get(nameA);
+  Simulator::Schedule(MilliSeconds(2), &extendLifetime, &measurements, nameB,
+                      Measurements::getInitialLifetime());
+
+  Simulator::Schedule(MicroSeconds(3999900), &checkEntry, &measurements, nameA, true);
+  Simulator::Schedule(MicroSeconds(4000100), &checkEntry, &measurements, nameA, false);
+  Simulator::Schedule(MicroSeconds(4000100), &checkEntry, &measurements, nameB, true);
+  Simulator::Schedule(MicroSeconds(4004900), &checkEntry, &measurements, nameB, true);
+  Simulator::Schedule(MicroSeconds(4005100), &checkEntry, &measurements, nameB, false);
+  Simulator::Schedule(MicroSeconds(4005100), &checkSize, &measurements, 0);
+
+  Simulator::Stop(Seconds(5));
+  Simulator::Run();
+}
+
+/** \brief detach the Measurements entry from its name tree entry, as if it was erased
+ */
+static void
+detachEntry(NameTree* nameTree, const Name& name)
+{
+  shared_ptr<nfd::name_tree::Entry> nte = nameTree->lookup(name);
+  nte->setMeasurementsEntry(nullptr);
+  nameTree->eraseEntryIfEmpty(nte);
+}
+
+static void
+getEntry(Measurements* measurements, const Name& name)
+{
+  measurements->get(name);
+}
+
+BOOST_AUTO_TEST_CASE(ErasedBeforeSweep)
+{
+  StackHelper helper;
+
+  NameTree nameTree;
+  Measurements measurements(nameTree);
+  Name nameA("ndn:/A");
+
+  // the record of the first A entry is left in the queue at 4s;
+  // the sweep must skip it instead of removing the second A entry, which expires at 6s
+  measurements.get(nameA);
+  Simulator::Schedule(Seconds(1), &detachEntry, &nameTree, nameA);
+  Simulator::Schedule(Seconds(2), &getEntry, &measurements, nameA);
+
+  Simulator::Schedule(Seconds(1.5), &checkEntry, &measurements, nameA, false);
+  Simulator::Schedule(Seconds(4.5), &checkEntry, &measurements, nameA, true);
+  Simulator::Schedule(Seconds(6.1), &checkEntry, &measurements, nameA, false);
+
+  // an erased entry that is still referenced is skipped as well, and cannot be extended
+  Name nameB("ndn:/B");
+  shared_ptr<nfd::measurements::Entry> entryB = measurements.get(nameB);
+  Simulator::Schedule(Seconds(1), &detachEntry, &nameTree, nameB);
+  Simulator::Schedule(Seconds(5), &checkEntry, &measurements, nameB, false);
+
+  Simulator::Stop(Seconds(7));
+  Simulator::Run();
+
+  measurements.extendLifetime(*entryB, time::seconds(10));
+  BOOST_CHECK(measurements.findExactMatch(nameB) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(EraseNameTreeEntry)
+{
+  StackHelper helper;
+
+  NameTree nameTree;
+  Measurements measurements(nameTree);
+  size_t nNameTreeEntriesBefore = nameTree.size();
+
+  measurements.get("/A");
+  Simulator::Schedule(Seconds(4.01), &checkSize, &measurements, 0);
+
+  Simulator::Stop(Seconds(5));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(nameTree.size(), nNameTreeEntriesBefore);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,86 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "NFD/daemon/table/pit-entry.hpp"
+#include "NFD/tests/daemon/face/dummy-face.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::tests::DummyFace;
+
+BOOST_FIXTURE_TEST_SUITE(NfdTablePitEntry, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(OutRecordIndex)
+{
+  const size_t threshold = nfd::pit::Entry::OUT_RECORD_INDEX_THRESHOLD;
+
+  shared_ptr<Interest> interest = make_shared<Interest>("/A");
+  nfd::pit::Entry entry(*interest);
+
+  std::vector<shared_ptr<DummyFace>> faces;
+  for (size_t i = 0; i < threshold * 3; ++i) {
+    faces.push_back(make_shared<DummyFace>());
+  }
+
+  // every OutRecord present is found, and the others are not
+  auto checkOutRecords = [&] (size_t begin, size_t end) {
+    BOOST_CHECK_EQUAL(entry.getOutRecords().size(), end - begin);
+    for (size_t i = 0; i < faces.size(); ++i) {
+      auto outRecord = entry.getOutRecord(*faces[i]);
+      if (i >= begin && i < end) {
+        BOOST_REQUIRE(outRecord != entry.getOutRecords().end());
+        BOOST_CHECK(outRecord->getFace() == faces[i]);
+      }
+      else {
+        BOOST_CHECK(outRecord == entry.getOutRecords().end());
+      }
+    }
+  };
+
+  // crossing the threshold upwards, with updates of existing OutRecords in between
+  for (size_t i = 0; i < faces.size(); ++i) {
+    auto inserted = entry.insertOrUpdateOutRecord(faces[i], *interest);
+    BOOST_CHECK(inserted->getFace() == faces[i]);
+    BOOST_CHECK(entry.insertOrUpdateOutRecord(faces[i / 2], *interest) ==
+                entry.getOutRecord(*faces[i / 2]));
+    checkOutRecords(0, i + 1);
+  }
+
+  // crossing the threshold and the index removal point downwards
+  for (size_t i = 0; i < faces.size(); ++i) {
+    entry.deleteOutRecord(*faces[i]);
+    entry.deleteOutRecord(*faces[i]); // deleting an absent OutRecord does nothing
+    checkOutRecords(i + 1, faces.size());
+  }
+
+  // and upwards again, after the index was dropped
+  for (size_t i = 0; i <= threshold; ++i) {
+    entry.insertOrUpdateOutRecord(faces[i], *interest);
+  }
+  checkOutRecords(0, threshold + 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -1,39 +1,41 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /**
- * Copyright (c) 2014-2015,  Regents of the University of California,
- *                           Arizona Board of Regents,
- *                           Colorado State University,
- *                           University Pierre & Marie Curie, Sorbonne University,
- *                           Washington University in St. Louis,
- *                           Beijing Institute of Technology,
- *                           The University of Memphis.
+ * Copyright (c) 2011-2015  Regents of the University of California.
  *
- * This file is part of NFD (Named Data Networking Forwarding Daemon).
- * See AUTHORS.md for complete list of NFD authors and contributors.
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
  *
- * NFD is free software: you can redistribute it and/or modify it under the terms
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
  * of the GNU General Public License as published by the Free Software Foundation,
  * either version 3 of the License, or (at your option) any later version.
  *
- * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
  * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
  * PURPOSE.  See the GNU General Public License for more details.
  *
  * You should have received a copy of the GNU General Public License along with
- * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
- */
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
 
-#include "table/strategy-choice.hpp"
-#include "tests/daemon/fw/dummy-strategy.hpp"
+#include "NFD/daemon/table/strategy-choice.hpp"
+#include "NFD/daemon/fw/forwarder.hpp"
+#include "NFD/daemon/fw/strategy-registry.hpp"
+#include "NFD/tests/daemon/fw/dummy-strategy.hpp"
 
-#include "tests/test-common.hpp"
+#include "../../tests-common.hpp"
 
-namespace nfd {
-namespace tests {
+namespace ns3 {
+namespace ndn {
 
-BOOST_FIXTURE_TEST_SUITE(TableStrategyChoice, BaseFixture)
+using nfd::Forwarder;
+using nfd::StrategyChoice;
+using nfd::Measurements;
+using nfd::NameTree;
+using nfd::fw::Strategy;
+using nfd::tests::DummyStrategy;
 
-using fw::Strategy;
+BOOST_AUTO_TEST_SUITE(NfdTableStrategyChoice)
 
 BOOST_AUTO_TEST_CASE(Get)
 {
@@ -130,7 +132,6 @@ BOOST_AUTO_TEST_CASE(Effective)
 
 BOOST_AUTO_TEST_CASE(Enumerate)
 {
-
   Forwarder forwarder;
   Name nameP("ndn:/strategy/P");
   Name nameQ("ndn:/strategy/Q");
@@ -162,7 +163,7 @@ BOOST_AUTO_TEST_CASE(Enumerate)
   BOOST_CHECK_EQUAL(map.size(), 5);
 }
 
-class PStrategyInfo : public fw::StrategyInfo
+class PStrategyInfo : public nfd::fw::StrategyInfo
 {
 public:
   static constexpr int
@@ -305,7 +306,173 @@ BOOST_AUTO_TEST_CASE(Versioning)
   BOOST_CHECK_EQUAL(table.findEffectiveStrategy("ndn:/").getName(), name4);
 }
 
+class LazyStrategy : public DummyStrategy
+{
+public:
+  explicit
+  LazyStrategy(Forwarder& forwarder, const Name& name = STRATEGY_NAME)
+    : DummyStrategy(forwarder, name)
+  {
+    ++nInstances;
+  }
+
+public:
+  static const Name STRATEGY_NAME;
+  static int nInstances;
+};
+
+const Name LazyStrategy::STRATEGY_NAME("ndn:/strategy/lazy/%FD%01");
+int LazyStrategy::nInstances = 0;
+
+BOOST_AUTO_TEST_CASE(LazyInstallation)
+{
+  nfd::fw::registerStrategy<LazyStrategy>();
+  LazyStrategy::nInstances = 0;
+
+  Forwarder forwarder;
+  StrategyChoice& table = forwarder.getStrategyChoice();
+
+  // registered strategies are available, but not instantiated
+  BOOST_CHECK_EQUAL(table.hasStrategy("ndn:/strategy/lazy", false), true);
+  BOOST_CHECK_EQUAL(table.hasStrategy(LazyStrategy::STRATEGY_NAME, true), true);
+  BOOST_CHECK_EQUAL(LazyStrategy::nInstances, 0);
+
+  // instantiated once, on first use
+  BOOST_CHECK(table.insert("ndn:/A", "ndn:/strategy/lazy"));
+  BOOST_CHECK_EQUAL(LazyStrategy::nInstances, 1);
+  BOOST_CHECK(table.insert("ndn:/B", LazyStrategy::STRATEGY_NAME));
+  BOOST_CHECK_EQUAL(LazyStrategy::nInstances, 1);
+  BOOST_CHECK_EQUAL(&table.findEffectiveStrategy("ndn:/A"), &table.findEffectiveStrategy("ndn:/B"));
+  BOOST_CHECK_EQUAL(table.findEffectiveStrategy("ndn:/A").getName(), LazyStrategy::STRATEGY_NAME);
+
+  // explicitly installed strategy takes precedence over registered strategy of the same name
+  Forwarder forwarder2;
+  StrategyChoice& table2 = forwarder2.getStrategyChoice();
+  shared_ptr<Strategy> installed = make_shared<DummyStrategy>(ref(forwarder2),
+                                                              LazyStrategy::STRATEGY_NAME);
+  BOOST_CHECK_EQUAL(table2.install(installed), true);
+  BOOST_CHECK(table2.insert("ndn:/A", "ndn:/strategy/lazy"));
+  BOOST_CHECK_EQUAL(&table2.findEffectiveStrategy("ndn:/A"), installed.get());
+  BOOST_CHECK_EQUAL(LazyStrategy::nInstances, 1);
+}
+
+static int g_nVersionedInstances = 0;
+
+/** \brief registered strategy ndn:/strategy/versioned/<VERSION>
+ */
+template<int VERSION>
+class VersionedStrategy : public DummyStrategy
+{
+public:
+  explicit
+  VersionedStrategy(Forwarder& forwarder)
+    : DummyStrategy(forwarder, STRATEGY_NAME)
+  {
+    ++g_nVersionedInstances;
+  }
+
+public:
+  static const Name STRATEGY_NAME;
+};
+
+template<int VERSION>
+const Name VersionedStrategy<VERSION>::STRATEGY_NAME =
+  Name("ndn:/strategy/versioned").appendVersion(VERSION);
+
+static shared_ptr<Strategy>
+installVersion(Forwarder& forwarder, uint64_t version)
+{
+  Name strategyName = Name("ndn:/strategy/versioned").appendVersion(version);
+  auto strategy = make_shared<DummyStrategy>(ref(forwarder), strategyName);
+  BOOST_REQUIRE(forwarder.getStrategyChoice().install(strategy));
+  return strategy;
+}
+
+BOOST_AUTO_TEST_CASE(InstalledAndRegisteredVersions)
+{
+  nfd::fw::registerStrategy<VersionedStrategy<2>>();
+  nfd::fw::registerStrategy<VersionedStrategy<4>>();
+  g_nVersionedInstances = 0;
+  const Name unversioned("ndn:/strategy/versioned");
+
+  // installed version is lower than the latest registered version: latest version wins
+  Forwarder forwarder1;
+  StrategyChoice& table1 = forwarder1.getStrategyChoice();
+  shared_ptr<Strategy> installed1 = installVersion(forwarder1, 1);
+  BOOST_CHECK(table1.insert("ndn:/A", unversioned));
+  BOOST_CHECK_EQUAL(table1.findEffectiveStrategy("ndn:/A").getName(),
+                    VersionedStrategy<4>::STRATEGY_NAME);
+  BOOST_CHECK_EQUAL(g_nVersionedInstances, 1);
+  // an exact name selects that version, installed or registered
+  BOOST_CHECK(table1.insert("ndn:/B", installed1->getName()));
+  BOOST_CHECK_EQUAL(&table1.findEffectiveStrategy("ndn:/B"), installed1.get());
+  BOOST_CHECK(table1.insert("ndn:/C", VersionedStrategy<2>::STRATEGY_NAME));
+  BOOST_CHECK_EQUAL(table1.findEffectiveStrategy("ndn:/C").getName(),
+                    VersionedStrategy<2>::STRATEGY_NAME);
+  BOOST_CHECK_EQUAL(g_nVersionedInstances, 2);
+
+  // installed version lies between registered versions
+  Forwarder forwarder3;
+  StrategyChoice& table3 = forwarder3.getStrategyChoice();
+  shared_ptr<Strategy> installed3 = installVersion(forwarder3, 3);
+  BOOST_CHECK(table3.insert("ndn:/A", unversioned));
+  BOOST_CHECK_EQUAL(table3.findEffectiveStrategy("ndn:/A").getName(),
+                    VersionedStrategy<4>::STRATEGY_NAME);
+  BOOST_CHECK_EQUAL(g_nVersionedInstances, 3);
+
+  // installed version is the latest: no registered strategy is instantiated
+  Forwarder forwarder5;
+  StrategyChoice& table5 = forwarder5.getStrategyChoice();
+  shared_ptr<Strategy> installed5 = installVersion(forwarder5, 5);
+  BOOST_CHECK(table5.insert("ndn:/A", unversioned));
+  BOOST_CHECK_EQUAL(&table5.findEffectiveStrategy("ndn:/A"), installed5.get());
+  BOOST_CHECK_EQUAL(g_nVersionedInstances, 3);
+
+  // installed and registered with the same exact name: exact installed wins
+  Forwarder forwarder4;
+  StrategyChoice& table4 = forwarder4.getStrategyChoice();
+  shared_ptr<Strategy> installed4 = installVersion(forwarder4, 4);
+  BOOST_CHECK(table4.insert("ndn:/A", unversioned));
+  BOOST_CHECK_EQUAL(&table4.findEffectiveStrategy("ndn:/A"), installed4.get());
+  BOOST_CHECK(table4.insert("ndn:/B", VersionedStrategy<4>::STRATEGY_NAME));
+  BOOST_CHECK_EQUAL(&table4.findEffectiveStrategy("ndn:/B"), installed4.get());
+  BOOST_CHECK_EQUAL(g_nVersionedInstances, 3);
+}
+
+BOOST_AUTO_TEST_CASE(InstantiateOncePerForwarder)
+{
+  nfd::fw::registerStrategy<VersionedStrategy<2>>();
+  nfd::fw::registerStrategy<VersionedStrategy<4>>();
+  g_nVersionedInstances = 0;
+
+  Forwarder forwarder;
+  StrategyChoice& table = forwarder.getStrategyChoice();
+  BOOST_CHECK_EQUAL(table.hasStrategy(VersionedStrategy<2>::STRATEGY_NAME, true), true);
+  BOOST_CHECK_EQUAL(table.hasStrategy("ndn:/strategy/versioned/%FD%03", true), false);
+  BOOST_CHECK_EQUAL(g_nVersionedInstances, 0);
+
+  // instantiated by the first insert and shared by later ones;
+  // the unversioned name instantiates the latest version
+  BOOST_CHECK(table.insert("ndn:/A", VersionedStrategy<2>::STRATEGY_NAME));
+  BOOST_CHECK(table.insert("ndn:/B", VersionedStrategy<2>::STRATEGY_NAME));
+  BOOST_CHECK(table.insert("ndn:/A", "ndn:/strategy/versioned"));
+  BOOST_CHECK(table.insert("ndn:/A", VersionedStrategy<2>::STRATEGY_NAME));
+  BOOST_CHECK_EQUAL(&table.findEffectiveStrategy("ndn:/A"), &table.findEffectiveStrategy("ndn:/B"));
+  BOOST_CHECK_EQUAL(g_nVersionedInstances, 2);
+
+  // a failed insert does not instantiate anything
+  BOOST_CHECK(!table.insert("ndn:/C", "ndn:/strategy/versioned/%FD%03"));
+  BOOST_CHECK_EQUAL(g_nVersionedInstances, 2);
+
+  // another forwarder gets its own instance
+  Forwarder forwarder2;
+  StrategyChoice& table2 = forwarder2.getStrategyChoice();
+  BOOST_CHECK(table2.insert("ndn:/A", VersionedStrategy<2>::STRATEGY_NAME));
+  BOOST_CHECK_EQUAL(g_nVersionedInstances, 3);
+  BOOST_CHECK(&table2.findEffectiveStrategy("ndn:/A") != &table.findEffectiveStrategy("ndn:/A"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
-} // namespace tests
-} // namespace nfd
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,278 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "NFD/daemon/table/strategy-info-host.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::StrategyInfoHost;
+using nfd::StrategyInfoAllocator;
+using nfd::fw::StrategyInfo;
+
+static int g_DummyStrategyInfo_count = 0;
+
+class DummyStrategyInfo : public StrategyInfo
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 1;
+  }
+
+  DummyStrategyInfo(int id)
+    : m_id(id)
+  {
+    ++g_DummyStrategyInfo_count;
+  }
+
+  virtual
+  ~DummyStrategyInfo()
+  {
+    --g_DummyStrategyInfo_count;
+  }
+
+  int m_id;
+};
+
+class DummyStrategyInfo2 : public StrategyInfo
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 2;
+  }
+
+  DummyStrategyInfo2(int id)
+    : m_id(id)
+  {
+  }
+
+  int m_id;
+};
+
+template<int ID>
+class DummyStrategyInfoN : public StrategyInfo
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return ID;
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(NfdTableStrategyInfoHost)
+
+BOOST_AUTO_TEST_CASE(SetGetClear)
+{
+  StrategyInfoHost host;
+
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfo>() == nullptr);
+
+  g_DummyStrategyInfo_count = 0;
+
+  shared_ptr<DummyStrategyInfo> info = make_shared<DummyStrategyInfo>(7591);
+  host.setStrategyInfo(info);
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 7591);
+
+  info.reset(); // unlink local reference
+  // host should still have a reference to info
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 7591);
+
+  host.clearStrategyInfo();
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfo>() == nullptr);
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Create)
+{
+  StrategyInfoHost host;
+
+  host.getOrCreateStrategyInfo<DummyStrategyInfo>(3503);
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 3503);
+
+  host.getOrCreateStrategyInfo<DummyStrategyInfo>(1032);
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 3503);
+
+  host.setStrategyInfo<DummyStrategyInfo>(nullptr);
+  host.getOrCreateStrategyInfo<DummyStrategyInfo>(9956);
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 9956);
+}
+
+BOOST_AUTO_TEST_CASE(Types)
+{
+  StrategyInfoHost host;
+
+  host.getOrCreateStrategyInfo<DummyStrategyInfo>(8063);
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 8063);
+
+  host.getOrCreateStrategyInfo<DummyStrategyInfo2>(2871);
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo2>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo2>()->m_id, 2871);
+
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 8063);
+}
+
+BOOST_AUTO_TEST_CASE(ManyTypes)
+{
+  StrategyInfoHost host;
+
+  auto info11 = host.getOrCreateStrategyInfo<DummyStrategyInfoN<11>>();
+  auto info12 = host.getOrCreateStrategyInfo<DummyStrategyInfoN<12>>();
+  auto info13 = host.getOrCreateStrategyInfo<DummyStrategyInfoN<13>>();
+  auto info14 = host.getOrCreateStrategyInfo<DummyStrategyInfoN<14>>();
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<11>>() == info11);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<12>>() == info12);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<13>>() == info13);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<14>>() == info14);
+
+  host.setStrategyInfo<DummyStrategyInfoN<12>>(nullptr);
+  host.setStrategyInfo<DummyStrategyInfoN<13>>(nullptr);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<11>>() == info11);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<12>>() == nullptr);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<13>>() == nullptr);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<14>>() == info14);
+
+  // replacing an item does not create a duplicate
+  shared_ptr<DummyStrategyInfoN<14>> info14b = make_shared<DummyStrategyInfoN<14>>();
+  host.setStrategyInfo(info14b);
+  host.setStrategyInfo<DummyStrategyInfoN<14>>(nullptr);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<14>>() == nullptr);
+
+  host.clearStrategyInfo();
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<11>>() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ReplaceAfterFreeSlot)
+{
+  StrategyInfoHost host;
+
+  // two inline slots
+  host.getOrCreateStrategyInfo<DummyStrategyInfoN<31>>();
+  host.getOrCreateStrategyInfo<DummyStrategyInfoN<32>>();
+  host.setStrategyInfo<DummyStrategyInfoN<31>>(nullptr);
+
+  // the first slot is free now, but the item of the same type in the second slot is replaced
+  auto info32 = make_shared<DummyStrategyInfoN<32>>();
+  host.setStrategyInfo(info32);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<32>>() == info32);
+  host.setStrategyInfo<DummyStrategyInfoN<32>>(nullptr);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<32>>() == nullptr);
+
+  // same for an item that did not fit into the inline slots
+  host.getOrCreateStrategyInfo<DummyStrategyInfoN<31>>();
+  host.getOrCreateStrategyInfo<DummyStrategyInfoN<32>>();
+  host.getOrCreateStrategyInfo<DummyStrategyInfoN<33>>();
+  host.setStrategyInfo<DummyStrategyInfoN<31>>(nullptr);
+
+  auto info33 = make_shared<DummyStrategyInfoN<33>>();
+  host.setStrategyInfo(info33);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<33>>() == info33);
+  host.setStrategyInfo<DummyStrategyInfoN<33>>(nullptr);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<33>>() == nullptr);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<32>>() != nullptr);
+
+  // a new type takes the free slot
+  auto info34 = host.getOrCreateStrategyInfo<DummyStrategyInfoN<34>>();
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<34>>() == info34);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<31>>() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(RecycleMemory)
+{
+  g_DummyStrategyInfo_count = 0;
+
+  StrategyInfoHost host;
+  const DummyStrategyInfo* address = host.getOrCreateStrategyInfo<DummyStrategyInfo>(1).get();
+  host.clearStrategyInfo();
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 0);
+
+  StrategyInfoHost host2;
+  BOOST_CHECK_EQUAL(host2.getOrCreateStrategyInfo<DummyStrategyInfo>(2).get(), address);
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 1);
+}
+
+BOOST_AUTO_TEST_CASE(FreeListReuse)
+{
+  typedef StrategyInfoAllocator<DummyStrategyInfoN<41>> Allocator;
+  Allocator allocator;
+
+  DummyStrategyInfoN<41>* a = allocator.allocate(1);
+  DummyStrategyInfoN<41>* b = allocator.allocate(1);
+  BOOST_CHECK(a != b);
+  allocator.deallocate(a, 1);
+  allocator.deallocate(b, 1);
+
+  // the most recently freed block is reused first
+  BOOST_CHECK_EQUAL(allocator.allocate(1), b);
+  BOOST_CHECK_EQUAL(allocator.allocate(1), a);
+
+  // blocks are kept per type
+  StrategyInfoAllocator<DummyStrategyInfoN<42>> otherAllocator;
+  allocator.deallocate(a, 1);
+  DummyStrategyInfoN<42>* c = otherAllocator.allocate(1);
+  BOOST_CHECK(static_cast<void*>(c) != static_cast<void*>(a));
+  BOOST_CHECK_EQUAL(allocator.allocate(1), a);
+
+  allocator.deallocate(a, 1);
+  allocator.deallocate(b, 1);
+  otherAllocator.deallocate(c, 1);
+}
+
+BOOST_AUTO_TEST_CASE(FreeListCap)
+{
+  typedef StrategyInfoAllocator<DummyStrategyInfoN<43>> Allocator;
+  Allocator allocator;
+
+  std::vector<DummyStrategyInfoN<43>*> blocks;
+  for (size_t i = 0; i <= Allocator::MAX_FREE_BLOCKS; ++i) {
+    blocks.push_back(allocator.allocate(1));
+  }
+  for (DummyStrategyInfoN<43>* block : blocks) {
+    allocator.deallocate(block, 1);
+  }
+
+  // the block freed after the list was full went back to the heap,
+  // the others are reused in reverse order
+  for (size_t i = Allocator::MAX_FREE_BLOCKS; i > 0; --i) {
+    BOOST_REQUIRE_EQUAL(allocator.allocate(1), blocks[i - 1]);
+  }
+
+  for (size_t i = 0; i < Allocator::MAX_FREE_BLOCKS; ++i) {
+    allocator.deallocate(blocks[i], 1);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
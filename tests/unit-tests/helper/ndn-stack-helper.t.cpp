@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "helper/ndn-stack-helper.hpp"
+#include "helper/ndn-fib-helper.hpp"
+#include "helper/ndn-strategy-choice-helper.hpp"
+#include "helper/ndn-app-helper.hpp"
+
+#include "ns3/point-to-point-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class DataPlaneOnlyFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  DataPlaneOnlyFixture()
+  {
+    Config::SetDefault("ns3::ndn::L3Protocol::DataPlaneOnly", BooleanValue(true));
+
+    createTopology({
+        {"1", "2"},
+        {"1", "3"}
+      });
+  }
+
+  ~DataPlaneOnlyFixture()
+  {
+    Config::SetDefault("ns3::ndn::L3Protocol::DataPlaneOnly", BooleanValue(false));
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(HelperNdnStackHelper)
+
+BOOST_FIXTURE_TEST_CASE(DataPlaneOnly, DataPlaneOnlyFixture)
+{
+  Ptr<L3Protocol> l3 = getNode("1")->GetObject<L3Protocol>();
+  BOOST_CHECK(l3->isDataPlaneOnly());
+  BOOST_CHECK(l3->getFibManager() == nullptr);
+  BOOST_CHECK(l3->getStrategyChoiceManager() == nullptr);
+  BOOST_CHECK(l3->getForwarder()->getFib().findExactMatch("/localhost/nfd") == nullptr);
+
+  addRoutes({
+      {"1", "2", "/prefix", 1},
+      {"1", "3", "/prefix", 1}
+    });
+  BOOST_CHECK_EQUAL(l3->getForwarder()->getFib().findExactMatch("/prefix")->getNextHops().size(),
+                    2);
+
+  FibHelper::RemoveRoute(getNode("1"), "/prefix", getNode("3"));
+  BOOST_CHECK_EQUAL(l3->getForwarder()->getFib().findExactMatch("/prefix")->getNextHops().size(),
+                    1);
+  addRoutes({
+      {"1", "3", "/prefix", 1}
+    });
+
+  StrategyChoiceHelper::Install(getNode("1"), "/prefix", "/localhost/nfd/strategy/multicast");
+  BOOST_CHECK_EQUAL(l3->getForwarder()->getStrategyChoice().findEffectiveStrategy("/prefix")
+                      .getName(), Name("/localhost/nfd/strategy/multicast"));
+
+  addApps({
+      {"1", "ns3::ndn::ConsumerCbr",
+          {{"Prefix", "/prefix"}, {"Frequency", "1"}},
+          "0s", "9.99s"},
+      {"2", "ns3::ndn::Producer",
+          {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+          "0s", "100s"}
+    });
+
+  Simulator::Stop(Seconds(20.001));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(getFace("1", "2")->getFaceStatus().getNOutInterests(), 10);
+  BOOST_CHECK_EQUAL(getFace("1", "3")->getFaceStatus().getNOutInterests(), 10);
+  BOOST_CHECK_EQUAL(getFace("1", "2")->getFaceStatus().getNInDatas(), 10);
+}
+
+BOOST_FIXTURE_TEST_CASE(InstallOnContainer, CleanupFixture)
+{
+  NodeContainer nodes;
+  nodes.Create(20);
+  PointToPointHelper p2p;
+  for (uint32_t i = 1; i < nodes.GetN(); ++i) {
+    p2p.Install(nodes.Get(i - 1), nodes.Get(i));
+  }
+
+  StackHelper ndnHelper;
+  ndnHelper.setCsSize(42);
+  Ptr<FaceContainer> faces = ndnHelper.Install(nodes);
+  BOOST_CHECK_EQUAL(faces->GetN(), 2 * (nodes.GetN() - 1));
+
+  for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+    Ptr<L3Protocol> l3 = nodes.Get(i)->GetObject<L3Protocol>();
+    BOOST_REQUIRE(l3 != nullptr);
+    BOOST_CHECK_EQUAL(l3->getForwarder()->getCs().getLimit(), 42);
+    BOOST_CHECK_EQUAL(l3->getForwarder()->getStrategyChoice().findEffectiveStrategy("/localhost")
+                        .getName(), Name("/localhost/nfd/strategy/multicast"));
+    BOOST_CHECK(l3->getForwarder()->getFib().findExactMatch("/localhost/nfd") != nullptr);
+  }
+
+  FibHelper::AddRoute(nodes.Get(0), "/prefix", nodes.Get(1), 1);
+  FibHelper::AddRoute(nodes.Get(1), "/prefix", nodes.Get(2), 1);
+
+  AppHelper consumer("ns3::ndn::ConsumerCbr");
+  consumer.SetPrefix("/prefix");
+  consumer.SetAttribute("Frequency", StringValue("1"));
+  consumer.SetAttribute("StopTime", StringValue("9.99s"));
+  consumer.Install(nodes.Get(0));
+  AppHelper producer("ns3::ndn::Producer");
+  producer.SetPrefix("/prefix");
+  producer.Install(nodes.Get(2));
+
+  Simulator::Stop(Seconds(20.001));
+  Simulator::Run();
+
+  // the first face is the face of node 0 towards node 1
+  BOOST_CHECK_EQUAL(faces->Get(0)->getFaceStatus().getNInDatas(), 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/cs/content-store-with-byte-limit.hpp"
+#include "utils/trie/lru-policy.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(ModelCsByteLimit, CleanupFixture)
+
+static shared_ptr<Data>
+makeData(const Name& name, size_t contentSize)
+{
+  auto data = make_shared<Data>(name);
+  data->setContent(make_shared< ::ndn::Buffer>(contentSize));
+  StackHelper::getKeyChain().sign(*data);
+  return data;
+}
+
+BOOST_AUTO_TEST_CASE(Eviction)
+{
+  Ptr<ContentStore> cs = CreateObject<cs::ContentStoreWithByteLimit<ndnSIM::lru_policy_traits>>();
+  cs->SetAttribute("MaxSize", UintegerValue(0));
+
+  shared_ptr<Data> large = makeData("/large", 4000);
+  size_t largeSize = large->wireEncode().size();
+  cs->SetAttribute("MaxBytes", UintegerValue(largeSize));
+
+  cs->Add(large);
+  BOOST_CHECK_EQUAL(cs->GetSize(), 1);
+  BOOST_CHECK_EQUAL(cs->GetSizeInBytes(), largeSize);
+
+  // small packets evict the large one, and then fit many at a time
+  size_t smallSize = 0;
+  for (int i = 0; i < 10; ++i) {
+    shared_ptr<Data> small = makeData(Name("/small").appendNumber(i), 10);
+    smallSize += small->wireEncode().size();
+    cs->Add(small);
+  }
+  BOOST_CHECK_EQUAL(cs->GetSize(), 10);
+  BOOST_CHECK_EQUAL(cs->GetSizeInBytes(), smallSize);
+  BOOST_CHECK(cs->Lookup(make_shared<Interest>("/large")) == nullptr);
+
+  // packets larger than the budget are not cached
+  cs->Add(makeData("/larger", 5000));
+  BOOST_CHECK_EQUAL(cs->GetSize(), 10);
+  BOOST_CHECK(cs->Lookup(make_shared<Interest>("/larger")) == nullptr);
+
+  // lowering the budget evicts least recently used packets
+  cs->SetAttribute("MaxBytes", UintegerValue(smallSize / 2));
+  BOOST_CHECK_LE(cs->GetSizeInBytes(), smallSize / 2);
+  BOOST_CHECK(cs->Lookup(make_shared<Interest>("/small/%09")) != nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/cs/content-store-with-update-rate.hpp"
+#include "utils/trie/lru-policy.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(ModelCsUpdateRate, CleanupFixture)
+
+typedef cs::ContentStoreWithUpdateRate<ndnSIM::lru_policy_traits> UpdateRateLru;
+
+static shared_ptr<Data>
+makeData(const Name& name, int timestamp)
+{
+  auto data = make_shared<Data>(name);
+  data->setDataTimestamp(timestamp);
+  StackHelper::getKeyChain().sign(*data);
+  return data;
+}
+
+// replace cached version the same way as the forwarder does
+static void
+refresh(Ptr<ContentStore> cs, shared_ptr<Data> data)
+{
+  cs->Erase(data);
+  cs->Add(data);
+}
+
+BOOST_AUTO_TEST_CASE(Admission)
+{
+  Ptr<UpdateRateLru> cs = CreateObject<UpdateRateLru>();
+  cs->SetAttribute("MaxSize", UintegerValue(0));
+  cs->SetAttribute("MinUpdateInterval", TimeValue(Seconds(1000)));
+
+  // /stable is updated every 2000s, /volatile every 1s
+  for (int i = 0; i < 10; ++i) {
+    refresh(cs, makeData("/stable", i * 2000));
+    refresh(cs, makeData("/volatile", i));
+  }
+  BOOST_CHECK(cs->Lookup(make_shared<Interest>("/stable")) != nullptr);
+  BOOST_CHECK_EQUAL(cs->GetNUpdates(), 18);
+
+  // both are admitted when seen for the first time, /volatile is admitted with probability 0.001
+  // afterwards
+  BOOST_CHECK_GE(cs->GetNRejected(), 7);
+  BOOST_CHECK_EQUAL(cs->GetNAdmitted() + cs->GetNRejected(), 20);
+
+  // re-adding the same version does not count as an update
+  refresh(cs, makeData("/stable", 18000));
+  BOOST_CHECK_EQUAL(cs->GetNUpdates(), 18);
+}
+
+BOOST_AUTO_TEST_CASE(Disabled)
+{
+  Ptr<UpdateRateLru> cs = CreateObject<UpdateRateLru>();
+  cs->SetAttribute("MinUpdateInterval", TimeValue(Seconds(0)));
+
+  for (int i = 0; i < 10; ++i) {
+    refresh(cs, makeData("/volatile", i));
+  }
+  BOOST_CHECK_EQUAL(cs->GetNAdmitted(), 10);
+  BOOST_CHECK_EQUAL(cs->GetNRejected(), 0);
+  BOOST_CHECK(cs->Lookup(make_shared<Interest>("/volatile")) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(History)
+{
+  Ptr<UpdateRateLru> cs = CreateObject<UpdateRateLru>();
+  cs->SetAttribute("MinUpdateInterval", TimeValue(Seconds(1000)));
+  cs->SetAttribute("MaxHistorySize", UintegerValue(10));
+
+  refresh(cs, makeData("/volatile", 0));
+  for (int i = 0; i < 10; ++i) {
+    refresh(cs, makeData(Name("/other").appendNumber(i), 0));
+  }
+
+  // history of /volatile has been forgotten, so it is treated as new content
+  refresh(cs, makeData("/volatile", 1));
+  BOOST_CHECK_EQUAL(cs->GetNUpdates(), 0);
+  BOOST_CHECK_EQUAL(cs->GetNRejected(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
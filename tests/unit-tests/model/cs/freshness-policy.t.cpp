@@ -0,0 +1,198 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "model/cs/custom-policies/freshness-policy.hpp"
+#include "utils/trie/trie-with-policy.hpp"
+
+#include <random>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+struct Item {
+  shared_ptr<const Data>
+  GetData() const
+  {
+    return data;
+  }
+
+  shared_ptr<Data> data;
+};
+
+/** \brief items in a freshness policy, inserted at time zero
+ */
+class FreshnessCache {
+public:
+  typedef trie_with_policy<Name, pointer_payload_traits<Item>, freshness_policy_traits> Trie;
+
+  FreshnessCache()
+    : m_items(100)
+  {
+  }
+
+  void
+  insert(size_t i, const Time& freshness)
+  {
+    Name name = Name("/a").appendNumber(i);
+    m_items[i].data = make_shared<Data>(name);
+    m_items[i].data->setFreshnessPeriod(time::milliseconds(freshness.GetMilliSeconds()));
+    m_trie.insert(name, &m_items[i]);
+  }
+
+  bool
+  contains(size_t i)
+  {
+    return m_trie.find_exact(Name("/a").appendNumber(i)) != m_trie.end();
+  }
+
+  Trie::policy_container&
+  policy()
+  {
+    return m_trie.getPolicy();
+  }
+
+private:
+  std::vector<Item> m_items;
+  Trie m_trie;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ModelCsFreshnessPolicy, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(ExpiryBeyondRevolution)
+{
+  // one revolution of the wheel is 10.24s at the default resolution of 10ms
+  FreshnessCache cache;
+  cache.insert(1, Seconds(1));
+  cache.insert(2, Seconds(30));
+  cache.insert(3, MilliSeconds(21480)); // two revolutions later, in the bucket of item 1
+  BOOST_CHECK_EQUAL(cache.policy().size(), 3);
+
+  BOOST_CHECK_EQUAL(cache.policy().get_next_expire_time(), Seconds(1));
+  cache.policy().expire(Seconds(1));
+  BOOST_CHECK(!cache.contains(1));
+  BOOST_CHECK(cache.contains(2));
+  BOOST_CHECK(cache.contains(3));
+
+  // next expiration time is a lower bound: the next non-empty bucket holds item 2
+  BOOST_CHECK_EQUAL(cache.policy().get_next_expire_time(), MilliSeconds(9520));
+
+  std::vector<std::pair<Time, size_t>> removals;
+  int nCalls = 0;
+  while (!cache.policy().empty()) {
+    Time now = cache.policy().get_next_expire_time();
+    BOOST_REQUIRE_LE(++nCalls, 10);
+    size_t size = cache.policy().size();
+    cache.policy().expire(now);
+    if (cache.policy().size() < size) {
+      removals.push_back(std::make_pair(now, size - cache.policy().size()));
+    }
+  }
+  BOOST_REQUIRE_EQUAL(removals.size(), 2);
+  BOOST_CHECK_EQUAL(removals[0].first, MilliSeconds(21480));
+  BOOST_CHECK_EQUAL(removals[1].first, Seconds(30));
+}
+
+BOOST_AUTO_TEST_CASE(SetResolution)
+{
+  FreshnessCache cache;
+  cache.insert(1, MilliSeconds(105));
+  cache.insert(2, MilliSeconds(2500));
+  BOOST_CHECK_EQUAL(cache.policy().get_next_expire_time(), MilliSeconds(110));
+
+  // items are re-bucketed and their expiration is rounded up to the new resolution
+  cache.policy().set_resolution(Seconds(1));
+  BOOST_CHECK_EQUAL(cache.policy().size(), 2);
+  BOOST_CHECK_EQUAL(cache.policy().get_next_expire_time(), Seconds(1));
+  BOOST_CHECK_EQUAL(cache.policy().get_expire_time(MilliSeconds(2500)), Seconds(3));
+
+  cache.policy().expire(MilliSeconds(999));
+  BOOST_CHECK(cache.contains(1));
+  cache.policy().expire(Seconds(1));
+  BOOST_CHECK(!cache.contains(1));
+  BOOST_CHECK(cache.contains(2));
+  BOOST_CHECK_EQUAL(cache.policy().get_next_expire_time(), Seconds(3));
+
+  // ticks already swept at the old resolution are not swept again
+  cache.policy().set_resolution(MilliSeconds(1));
+  BOOST_CHECK_EQUAL(cache.policy().size(), 1);
+  // item 2 is now more than one revolution (1.024s) ahead of the last swept tick
+  BOOST_CHECK_EQUAL(cache.policy().get_next_expire_time(), MilliSeconds(1476));
+  cache.policy().expire(MilliSeconds(1476));
+  BOOST_CHECK(cache.contains(2));
+  cache.policy().expire(MilliSeconds(2499));
+  BOOST_CHECK(cache.contains(2));
+  cache.policy().expire(MilliSeconds(2500));
+  BOOST_CHECK(!cache.contains(2));
+  BOOST_CHECK(cache.policy().empty());
+}
+
+BOOST_AUTO_TEST_CASE(ExpireAfterLongGap)
+{
+  FreshnessCache cache;
+  cache.insert(1, MilliSeconds(500));
+  cache.insert(2, Seconds(5));
+  cache.insert(3, Seconds(15));
+  cache.insert(4, Seconds(25));
+
+  // 2000 ticks since the last call, almost two revolutions of the wheel
+  cache.policy().expire(Seconds(20));
+  BOOST_CHECK(!cache.contains(1));
+  BOOST_CHECK(!cache.contains(2));
+  BOOST_CHECK(!cache.contains(3));
+  BOOST_CHECK(cache.contains(4));
+  BOOST_CHECK_EQUAL(cache.policy().size(), 1);
+
+  BOOST_CHECK_EQUAL(cache.policy().get_next_expire_time(), Seconds(25));
+  cache.policy().expire(MilliSeconds(24990));
+  BOOST_CHECK(cache.contains(4));
+  cache.policy().expire(Seconds(25));
+  BOOST_CHECK(cache.policy().empty());
+  BOOST_CHECK_EQUAL(cache.policy().get_next_expire_time(), Time());
+}
+
+BOOST_AUTO_TEST_CASE(RemovedAtEndOfTick)
+{
+  FreshnessCache cache;
+  std::vector<Time> expireTimes;
+  std::mt19937 generator(1);
+  std::uniform_int_distribution<int64_t> distribution(1, 40000);
+  for (size_t i = 0; i < 100; ++i) {
+    Time freshness = MilliSeconds(distribution(generator));
+    cache.insert(i, freshness);
+    expireTimes.push_back(cache.policy().get_expire_time(freshness));
+  }
+
+  while (!cache.policy().empty()) {
+    Time now = cache.policy().get_next_expire_time();
+    cache.policy().expire(now);
+    for (size_t i = 0; i < expireTimes.size(); ++i) {
+      BOOST_REQUIRE_EQUAL(cache.contains(i), expireTimes[i] > now);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndnSIM
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "model/ndn-l3-protocol.hpp"
+#include "helper/ndn-app-helper.hpp"
+#include "NFD/daemon/fw/forwarder.hpp"
+
+#include <ndn-cxx/face.hpp>
+#include <ndn-cxx/util/scheduler.hpp>
+#include <ndn-cxx/util/signal-scoped-connection.hpp>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class L3ProtocolFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  L3ProtocolFixture()
+  {
+    createTopology({{"A", "B"}});
+
+    forwarder = getNode("A")->GetObject<L3Protocol>()->getForwarder();
+  }
+
+protected:
+  shared_ptr<nfd::Forwarder> forwarder;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ModelNdnL3Protocol, L3ProtocolFixture)
+
+/** \brief registers a prefix through NFD RIB and unregisters it one second later
+ */
+class PrefixRegistrant
+{
+public:
+  typedef std::function<void()> VoidCallback;
+
+  PrefixRegistrant(const Name& prefix, const VoidCallback& onRegistered,
+                   const VoidCallback& onUnregistered)
+    : m_scheduler(m_face.getIoService())
+  {
+    m_prefixId = m_face.setInterestFilter(prefix,
+      [] (const ::ndn::InterestFilter&, const Interest&) {},
+      [this, onRegistered, onUnregistered] (const Name&) {
+        onRegistered();
+        m_scheduler.scheduleEvent(time::seconds(1), [this, onUnregistered] {
+            m_face.unregisterPrefix(m_prefixId, onUnregistered, [] (const std::string& reason) {
+                BOOST_ERROR("Unexpected failure to unregister prefix: " << reason);
+              });
+          });
+      },
+      [] (const Name&, const std::string& reason) {
+        BOOST_ERROR("Unexpected failure to register prefix: " << reason);
+      });
+  }
+
+private:
+  ::ndn::Face m_face;
+  ::ndn::Scheduler m_scheduler;
+  const ::ndn::RegisteredPrefixId* m_prefixId;
+};
+
+BOOST_AUTO_TEST_CASE(RibUpdatesFibDirectly)
+{
+  // FIB management commands are delivered to the internal face
+  size_t nFibCommands = 0;
+  ::ndn::util::signal::ScopedConnection connection =
+    forwarder->getFace(nfd::FACEID_INTERNAL_FACE)->onSendInterest.connect(
+      [&nFibCommands] (const Interest& interest) {
+        if (Name("/localhost/nfd/fib").isPrefixOf(interest.getName())) {
+          ++nFibCommands;
+        }
+      });
+
+  size_t nFibCommandsBeforeApp = 0;
+  bool isRegistered = false;
+  bool isUnregistered = false;
+  FactoryCallbackApp::Install(getNode("A"), [&] () -> shared_ptr<void> {
+      // commands sent by RIB manager when it starts are not counted
+      nFibCommandsBeforeApp = nFibCommands;
+
+      return make_shared<PrefixRegistrant>("/test/rib", [&] {
+          shared_ptr<nfd::fib::Entry> entry = forwarder->getFib().findExactMatch("/test/rib");
+          BOOST_REQUIRE(entry != nullptr);
+          BOOST_CHECK_EQUAL(entry->getNextHops().size(), 1);
+          isRegistered = true;
+        },
+        [&] {
+          BOOST_CHECK(forwarder->getFib().findExactMatch("/test/rib") == nullptr);
+          isUnregistered = true;
+        });
+    })
+    .Start(Seconds(1.0));
+
+  Simulator::Stop(Seconds(5.0));
+  Simulator::Run();
+
+  BOOST_CHECK(isRegistered);
+  BOOST_CHECK(isUnregistered);
+  BOOST_CHECK_EQUAL(nFibCommands, nFibCommandsBeforeApp);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
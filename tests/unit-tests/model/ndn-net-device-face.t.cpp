@@ -25,39 +25,203 @@
 namespace ns3 {
 namespace ndn {
 
-BOOST_FIXTURE_TEST_SUITE(ModelNdnNetDeviceFace, ScenarioHelperWithCleanupFixture)
+/** \brief two nodes connected by a point-to-point link, with a route for /prefix from 1 to 2
+ */
+class NetDeviceFaceFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  explicit
+  NetDeviceFaceFixture(const std::string& dataRate = "10Mbps",
+                       const std::string& maxPackets = "20")
+  {
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue(dataRate));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue(maxPackets));
+
+    createTopology({
+        {"1", "2"},
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1},
+      });
+
+    face12 = std::dynamic_pointer_cast<NetDeviceFace>(getFace("1", "2"));
+    face21 = std::dynamic_pointer_cast<NetDeviceFace>(getFace("2", "1"));
+    BOOST_REQUIRE(face12 != nullptr && face21 != nullptr);
+  }
+
+protected:
+  /** \brief installs a consumer on node 1 and a producer on node 2
+   */
+  void
+  addConsumerProducer(const std::string& frequency, const std::string& consumerStopTime,
+                      const std::string& payloadSize)
+  {
+    addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", frequency}},
+            "0s", consumerStopTime},
+        {"2", "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", payloadSize}},
+            "0s", "100s"}
+      });
+  }
+
+protected:
+  shared_ptr<NetDeviceFace> face12;
+  shared_ptr<NetDeviceFace> face21;
+};
+
+/** \brief link that is slower than the traffic offered by the consumer and producer
+ */
+class SlowLinkFixture : public NetDeviceFaceFixture
+{
+public:
+  SlowLinkFixture()
+    : NetDeviceFaceFixture("1Mbps", "100")
+  {
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(ModelNdnNetDeviceFace, NetDeviceFaceFixture)
 
 BOOST_AUTO_TEST_CASE(Basic)
 {
-  Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
-  Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
-  Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+  addConsumerProducer("10", "9.99s", "1024");
 
-  createTopology({
-      {"1", "2"},
-    });
+  Simulator::Stop(Seconds(20.001));
+  Simulator::Run();
 
-  addRoutes({
-      {"1", "2", "/prefix", 1},
-    });
+  BOOST_CHECK_EQUAL(face12->getFaceStatus().getNOutInterests(), 100);
+  BOOST_CHECK_EQUAL(face12->getFaceStatus().getNInDatas(), 100);
+
+  BOOST_CHECK_EQUAL(face21->getFaceStatus().getNInInterests(), 100);
+  BOOST_CHECK_EQUAL(face21->getFaceStatus().getNOutDatas(), 100);
+}
+
+BOOST_AUTO_TEST_CASE(Fragmentation)
+{
+  // Data packets are larger than MTU of point-to-point links (1500 bytes)
+  addConsumerProducer("10", "9.99s", "4000");
+
+  Simulator::Stop(Seconds(20.001));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(face12->getFaceStatus().getNInDatas(), 100);
+  BOOST_CHECK_EQUAL(face21->getFaceStatus().getNOutDatas(), 100);
+
+  // each Data is sent in 3 fragments
+  BOOST_CHECK_EQUAL(face12->getNOutFrames(), 100);
+  BOOST_CHECK_EQUAL(face21->getNOutFrames(), 300);
+}
+
+BOOST_AUTO_TEST_CASE(Aggregation)
+{
+  face12->setAggregationWindow(MilliSeconds(5));
+  face21->setAggregationWindow(MilliSeconds(5));
+
+  addConsumerProducer("1000", "0.9999s", "100");
+
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(face12->getFaceStatus().getNOutInterests(), 1000);
+  BOOST_CHECK_EQUAL(face12->getFaceStatus().getNInDatas(), 1000);
+  BOOST_CHECK_EQUAL(face21->getFaceStatus().getNInInterests(), 1000);
+  BOOST_CHECK_EQUAL(face21->getFaceStatus().getNOutDatas(), 1000);
+
+  // about 5 packets per frame
+  BOOST_CHECK_LT(face12->getNOutFrames(), 300);
+  BOOST_CHECK_LT(face21->getNOutFrames(), 300);
+}
+
+static void
+checkLoadEstimatesOfBusyLink(shared_ptr<NetDeviceFace> face12, shared_ptr<NetDeviceFace> face21)
+{
+  BOOST_CHECK_GT(face21->getQueueLength(), 50);
+  BOOST_CHECK_EQUAL(face12->getQueueLength(), 0);
+
+  // Data rate is limited by the link (125000 bytes per second), and exceeds Interest rate
+  BOOST_CHECK_GT(face21->getOutRate(), face12->getOutRate());
+  BOOST_CHECK_GT(face12->getInRate(), 100000);
+  BOOST_CHECK_LT(face12->getInRate(), 150000);
+  BOOST_CHECK_CLOSE(face21->getInRate(), face12->getOutRate(), 10);
+}
+
+BOOST_FIXTURE_TEST_CASE(LoadEstimates, SlowLinkFixture)
+{
+  // Data are produced faster than the link can carry them
+  addConsumerProducer("500", "0.9999s", "1000");
+
+  Simulator::Schedule(Seconds(0.5), &checkLoadEstimatesOfBusyLink, face12, face21);
+
+  Simulator::Stop(Seconds(10));
+  Simulator::Run();
+
+  // estimates decay without traffic
+  BOOST_CHECK_EQUAL(face21->getQueueLength(), 0);
+  BOOST_CHECK_LT(face12->getInRate(), 1);
+  BOOST_CHECK_LT(face21->getOutRate(), 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(InterestShaping, SlowLinkFixture)
+{
+  // consumer requests about four times more Data than the link can carry
+  face12->setInterestShapingRate(DataRate("1Mbps"));
+
+  addConsumerProducer("500", "0.9999s", "1000");
+
+  Simulator::Stop(Seconds(5));
+  Simulator::Run();
+
+  // excess Interests are dropped by the shaper, while every forwarded Interest brings Data back
+  BOOST_CHECK_GT(face12->getNShapingDrops(), 0);
+  BOOST_CHECK_GT(face21->getFaceStatus().getNInInterests(), 100);
+  BOOST_CHECK_EQUAL(face12->getFaceStatus().getNInDatas(),
+                    face21->getFaceStatus().getNInInterests());
+  BOOST_CHECK_CLOSE(face12->getExpectedDataSize(), 1100, 10);
+  BOOST_CHECK_EQUAL(face12->getQueueLength(), 0);
+
+  // dropped Interests are not counted as sent
+  BOOST_CHECK_EQUAL(face12->getFaceStatus().getNOutInterests(),
+                    face21->getFaceStatus().getNInInterests());
+}
+
+static void
+checkShapingQueueOfShortLivedInterests(shared_ptr<NetDeviceFace> face12)
+{
+  // only Interests received within the last 100ms (about 50 of them) wait for shaping
+  BOOST_CHECK_LT(face12->getQueueLength(), 60);
+  BOOST_CHECK_GT(face12->getNShapingExpirations(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(InterestShapingExpiry, SlowLinkFixture)
+{
+  // Interests expire long before the shaping queue is full; consumer does not retransmit them
+  face12->setInterestShapingRate(DataRate("1Mbps"));
 
   addApps({
       {"1", "ns3::ndn::ConsumerCbr",
-          {{"Prefix", "/prefix"}, {"Frequency", "10"}},
-          "0s", "9.99s"},
+          {{"Prefix", "/prefix"}, {"Frequency", "500"}, {"LifeTime", "100ms"},
+           {"RetxTimer", "100s"}},
+          "0s", "0.9999s"},
       {"2", "ns3::ndn::Producer",
-          {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+          {{"Prefix", "/prefix"}, {"PayloadSize", "1000"}},
           "0s", "100s"}
     });
 
-  Simulator::Stop(Seconds(20.001));
-  Simulator::Run();
+  Simulator::Schedule(Seconds(0.5), &checkShapingQueueOfShortLivedInterests, face12);
 
-  BOOST_CHECK_EQUAL(getFace("1", "2")->getFaceStatus().getNOutInterests(), 100);
-  BOOST_CHECK_EQUAL(getFace("1", "2")->getFaceStatus().getNInDatas(), 100);
+  Simulator::Stop(Seconds(5));
+  Simulator::Run();
 
-  BOOST_CHECK_EQUAL(getFace("2", "1")->getFaceStatus().getNInInterests(), 100);
-  BOOST_CHECK_EQUAL(getFace("2", "1")->getFaceStatus().getNOutDatas(), 100);
+  // expired Interests are dropped instead of sent
+  BOOST_CHECK_EQUAL(face12->getNShapingDrops(), 0);
+  BOOST_CHECK_GT(face12->getNShapingExpirations(), 100);
+  BOOST_CHECK_EQUAL(face12->getFaceStatus().getNOutInterests(),
+                    face21->getFaceStatus().getNInInterests());
+  BOOST_CHECK_EQUAL(face12->getQueueLength(), 0);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -21,6 +21,7 @@
 #include "helper/ndn-stack-helper.hpp"
 #include "model/ndn-header.hpp"
 #include "utils/ndn-ns3-packet-tag.hpp"
+#include "utils/ndn-fw-hop-count-tag.hpp"
 
 #include <ndn-cxx/encoding/block.hpp>
 #include <ndn-cxx/interest.hpp>
@@ -54,6 +55,38 @@ BOOST_AUTO_TEST_CASE(ToPacket)
   BOOST_CHECK_EQUAL(type2, ::ndn::tlv::Data);
 }
 
+BOOST_AUTO_TEST_CASE(FromPacket)
+{
+  auto data = std::make_shared<ndn::Data>("/prefix");
+  data->setContent(std::make_shared< ::ndn::Buffer>(1024));
+  ndn::StackHelper::getKeyChain().sign(*data);
+
+  Ptr<Packet> packet = Convert::ToPacket(*data);
+  FwHopCountTag hopCount;
+  hopCount.Increment();
+  packet->AddPacketTag(hopCount);
+
+  shared_ptr<const ndn::Data> decoded = Convert::FromPacket<ndn::Data>(packet->Copy());
+  BOOST_CHECK_EQUAL(decoded->getName(), data->getName());
+  BOOST_CHECK(decoded->wireEncode() == data->wireEncode());
+
+  // ns-3 packet without the NDN packet is kept with its packet tags
+  auto tag = decoded->getTag<Ns3PacketTag>();
+  BOOST_REQUIRE(tag != nullptr);
+  BOOST_CHECK_EQUAL(tag->getPacket()->GetSize(), 0);
+  FwHopCountTag decodedHopCount;
+  BOOST_CHECK(tag->getPacket()->PeekPacketTag(decodedHopCount));
+  BOOST_CHECK_EQUAL(decodedHopCount.Get(), 1);
+
+  // decoding through PacketHeader gives the same packet
+  PacketHeader<ndn::Data> header;
+  BOOST_CHECK_EQUAL(packet->RemoveHeader(header), data->wireEncode().size());
+  BOOST_CHECK(header.getPacket()->wireEncode() == data->wireEncode());
+
+  Ptr<Packet> truncated = Convert::ToPacket(*data)->CreateFragment(0, 100);
+  BOOST_CHECK_THROW(Convert::FromPacket<ndn::Data>(truncated), ::ndn::tlv::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
@@ -0,0 +1,185 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include <ndn-cxx/encoding/block-view.hpp>
+#include <ndn-cxx/encoding/block-helpers.hpp>
+#include <ndn-cxx/interest.hpp>
+#include <ndn-cxx/data.hpp>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::ndn::BlockView;
+using ::ndn::makeNonNegativeIntegerBlock;
+using ::ndn::makeStringBlock;
+using ::ndn::makeEmptyBlock;
+using ::ndn::readNonNegativeInteger;
+using ::ndn::readString;
+namespace tlv = ::ndn::tlv;
+
+BOOST_AUTO_TEST_SUITE(NdnCxxBlockView)
+
+BOOST_AUTO_TEST_CASE(Index)
+{
+  Block outer(100);
+  outer.push_back(makeNonNegativeIntegerBlock(101, 42));
+  outer.push_back(makeStringBlock(102, "view"));
+  outer.push_back(makeEmptyBlock(103));
+  outer.encode();
+
+  BlockView view(outer);
+  BOOST_REQUIRE_EQUAL(view.size(), 3);
+  BOOST_CHECK_EQUAL(view[0].type(), 101);
+  BOOST_CHECK_EQUAL(view[1].type(), 102);
+  BOOST_CHECK_EQUAL(view[2].type(), 103);
+  BOOST_CHECK_EQUAL(view[2].value_size(), 0);
+
+  BOOST_CHECK_EQUAL(readNonNegativeInteger(view.get(101)), 42);
+  BOOST_CHECK_EQUAL(readString(view.get(102)), "view");
+  BOOST_CHECK(view.find(104) == nullptr);
+  BOOST_CHECK_THROW(view.get(104), Block::Error);
+
+  Block inner = view.toBlock(view.get(102));
+  BOOST_CHECK_EQUAL(inner.type(), 102);
+  BOOST_CHECK(inner.getBuffer() == outer.getBuffer());
+  BOOST_CHECK_EQUAL(readString(inner), "view");
+}
+
+BOOST_AUTO_TEST_CASE(Overflow)
+{
+  Block outer(100);
+  size_t nElements = BlockView::INLINE_CAPACITY * 2 + 1;
+  for (size_t i = 0; i < nElements; ++i) {
+    outer.push_back(makeNonNegativeIntegerBlock(200 + i, i));
+  }
+  outer.encode();
+
+  BlockView view(outer);
+  BOOST_REQUIRE_EQUAL(view.size(), nElements);
+  for (size_t i = 0; i < nElements; ++i) {
+    BOOST_CHECK_EQUAL(view[i].type(), 200 + i);
+    BOOST_CHECK_EQUAL(readNonNegativeInteger(view[i]), i);
+  }
+  BOOST_CHECK_EQUAL(readNonNegativeInteger(view.get(200 + nElements - 1)), nElements - 1);
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  static const uint8_t WIRE[] = {
+    0x64, 0x04, // type 100, length 4
+      0x65, 0x05, 0x01, 0x02 // type 101, length 5 exceeds the remaining 2 octets
+  };
+
+  Block outer(WIRE, sizeof(WIRE));
+  BOOST_CHECK_THROW(BlockView view(outer), tlv::Error);
+  BOOST_CHECK_THROW(outer.parse(), tlv::Error);
+  BOOST_CHECK_EQUAL(outer.elements_size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(InterestRoundTrip)
+{
+  Exclude exclude;
+  exclude.excludeOne(name::Component("excluded"));
+
+  Interest interest("/interest/round/trip");
+  interest.setMinSuffixComponents(1)
+          .setMaxSuffixComponents(4)
+          .setExclude(exclude)
+          .setChildSelector(1)
+          .setMustBeFresh(true)
+          .setNonce(0x01020304)
+          .setInterestLifetime(time::milliseconds(1500))
+          .setInterestPITList("/pit/list")
+          .setInterestSignalFlag(2)
+          .setInterestNodeIndex(3)
+          .setInterestEntryIndex(4)
+          .setInterestTimestamp(5);
+  Block wire = interest.wireEncode();
+
+  Interest decoded(wire);
+  BOOST_CHECK_EQUAL(decoded.getName(), interest.getName());
+  BOOST_CHECK_EQUAL(decoded.getMinSuffixComponents(), 1);
+  BOOST_CHECK_EQUAL(decoded.getMaxSuffixComponents(), 4);
+  BOOST_CHECK_EQUAL(decoded.getExclude(), exclude);
+  BOOST_CHECK_EQUAL(decoded.getChildSelector(), 1);
+  BOOST_CHECK_EQUAL(decoded.getMustBeFresh(), true);
+  BOOST_CHECK_EQUAL(decoded.getNonce(), 0x01020304);
+  BOOST_CHECK_EQUAL(decoded.getInterestLifetime(), time::milliseconds(1500));
+  BOOST_CHECK_EQUAL(decoded.getInterestPITList(), "/pit/list");
+  BOOST_CHECK_EQUAL(decoded.getInterestSignalFlag(), 2);
+  BOOST_CHECK_EQUAL(decoded.getInterestNodeIndex(), 3);
+  BOOST_CHECK_EQUAL(decoded.getInterestEntryIndex(), 4);
+  BOOST_CHECK_EQUAL(decoded.getInterestTimestamp(), 5);
+  BOOST_CHECK(decoded == interest);
+
+  // fields absent from the wire are reset when an Interest is decoded again
+  Interest minimal("/minimal");
+  minimal.setNonce(42);
+  decoded.wireDecode(minimal.wireEncode());
+  BOOST_CHECK_EQUAL(decoded.getName(), Name("/minimal"));
+  BOOST_CHECK(decoded.getSelectors().empty());
+  BOOST_CHECK_EQUAL(decoded.getNonce(), 42);
+  BOOST_CHECK_EQUAL(decoded.getInterestLifetime(), ::ndn::DEFAULT_INTEREST_LIFETIME);
+}
+
+BOOST_AUTO_TEST_CASE(DataRoundTrip)
+{
+  Data data("/data/round/trip");
+  data.setContentType(tlv::ContentType_Key)
+      .setFreshnessPeriod(time::seconds(10))
+      .setFinalBlockId(name::Component::fromSegment(7))
+      .setContent(reinterpret_cast<const uint8_t*>("content"), 7)
+      .setDataSignalFlag(1)
+      .setDataTimestamp(2)
+      .setDataExpiration(3)
+      .setDataNodeIndex(4)
+      .setDataPITList("/pit/list");
+
+  Signature signature(SignatureInfo(tlv::DigestSha256));
+  signature.setValue(makeStringBlock(tlv::SignatureValue, "signature"));
+  data.setSignature(signature);
+  Block wire = data.wireEncode();
+
+  Data decoded(wire);
+  BOOST_CHECK_EQUAL(decoded.getName(), data.getName());
+  BOOST_CHECK_EQUAL(decoded.getContentType(), tlv::ContentType_Key);
+  BOOST_CHECK_EQUAL(decoded.getFreshnessPeriod(), time::seconds(10));
+  BOOST_CHECK_EQUAL(decoded.getFinalBlockId(), name::Component::fromSegment(7));
+  BOOST_CHECK_EQUAL(readString(decoded.getContent()), "content");
+  BOOST_CHECK_EQUAL(decoded.getSignature().getType(), tlv::DigestSha256);
+  BOOST_CHECK_EQUAL(readString(decoded.getSignature().getValue()), "signature");
+  BOOST_CHECK_EQUAL(decoded.getDataSignalFlag(), 1);
+  BOOST_CHECK_EQUAL(decoded.getDataTimestamp(), 2);
+  BOOST_CHECK_EQUAL(decoded.getDataExpiration(), 3);
+  BOOST_CHECK_EQUAL(decoded.getDataNodeIndex(), 4);
+  BOOST_CHECK_EQUAL(decoded.getDataPITList(), "/pit/list");
+  BOOST_CHECK(decoded == data);
+
+  // retained fields refer to the decoded wire instead of copies of it
+  BOOST_CHECK(decoded.getContent().getBuffer() == wire.getBuffer());
+  BOOST_CHECK_EQUAL(decoded.getFullName(), data.getFullName());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
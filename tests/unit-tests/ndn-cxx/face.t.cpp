@@ -263,6 +263,50 @@ BOOST_AUTO_TEST_CASE(ExpressMultipleInterests)
   BOOST_CHECK_EQUAL(recvCount, 10);
 }
 
+class PrefixInterests : public BaseTesterApp
+{
+public:
+  PrefixInterests(const Name& longName, const Name& shortName, const NameCallback& onData,
+                  const VoidCallback& onTimeout)
+  {
+    m_face.expressInterest(longName, std::bind([onData] (const Data& data) {
+          onData(data.getName());
+        }, _2),
+      std::bind(onTimeout));
+
+    m_face.expressInterest(shortName, std::bind([onData] (const Data& data) {
+          onData(data.getName());
+        }, _2),
+      std::bind(onTimeout));
+  }
+};
+
+BOOST_AUTO_TEST_CASE(ExpressInterestsSatisfiedBySameData)
+{
+  addApps({{"B", "ns3::ndn::Producer", {{"Prefix", "/test"}}, "0s", "100s"}});
+
+  std::vector<Name> received;
+
+  // Data for /test/prefix/long is also a match for the pending /test/prefix Interest
+  FactoryCallbackApp::Install(getNode("A"), [this, &received] () -> shared_ptr<void> {
+      return make_shared<PrefixInterests>("/test/prefix/long", "/test/prefix",
+        [&received] (const Name& data) {
+          received.push_back(data);
+        },
+        [] {
+          BOOST_ERROR("Unexpected timeout");
+        });
+    })
+    .Start(Seconds(1.01));
+
+  Simulator::Stop(Seconds(20));
+  Simulator::Run();
+
+  BOOST_REQUIRE_EQUAL(received.size(), 2);
+  BOOST_CHECK_EQUAL(received[0], "/test/prefix/long");
+  BOOST_CHECK_EQUAL(received[1], "/test/prefix/long");
+}
+
 class SingleInterestWithFaceShutdown : public BaseTesterApp
 {
 public:
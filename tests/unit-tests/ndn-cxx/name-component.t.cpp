@@ -0,0 +1,75 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include <ndn-cxx/name.hpp>
+
+#include "../tests-common.hpp"
+
+#include <unordered_set>
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(NdnCxxNameComponent)
+
+BOOST_AUTO_TEST_CASE(EqualsAndHash)
+{
+  std::hash<name::Component> hash;
+
+  const uint8_t digest[32] = {0x28, 0xba, 0xd4, 0xb5};
+  name::Component generic(digest, sizeof(digest));
+  name::Component same(digest, sizeof(digest));
+  BOOST_CHECK(generic == same);
+  BOOST_CHECK_EQUAL(hash(generic), hash(same));
+
+  // same TLV-VALUE with a different TLV-TYPE is a different component
+  name::Component implicit = name::Component::fromImplicitSha256Digest(digest, sizeof(digest));
+  BOOST_CHECK(generic != implicit);
+  BOOST_CHECK_NE(generic.compare(implicit), 0);
+  BOOST_CHECK_NE(hash(generic), hash(implicit));
+
+  Name withGeneric = Name("/A").append(generic);
+  Name withImplicit = Name("/A").append(implicit);
+  BOOST_CHECK(withGeneric != withImplicit);
+  BOOST_CHECK(!withGeneric.isPrefixOf(withImplicit));
+}
+
+BOOST_AUTO_TEST_CASE(HashDistribution)
+{
+  std::hash<name::Component> hash;
+
+  std::unordered_set<size_t> hashes;
+  std::unordered_set<size_t> highBits;
+  for (uint64_t i = 0; i < 10000; ++i) {
+    size_t value = hash(name::Component::fromNumber(i));
+    hashes.insert(value);
+    highBits.insert(static_cast<uint64_t>(value) >> 32);
+  }
+  BOOST_CHECK_EQUAL(hashes.size(), 10000);
+  if (sizeof(size_t) >= 8) {
+    // 32-bit CRC is spread over the whole value
+    BOOST_CHECK_GT(highBits.size(), 9000);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
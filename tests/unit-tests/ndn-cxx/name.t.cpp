@@ -0,0 +1,82 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include <ndn-cxx/name.hpp>
+
+#include "../tests-common.hpp"
+
+#include <thread>
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(NdnCxxName)
+
+BOOST_AUTO_TEST_CASE(Hashes)
+{
+  Name name("/first/second/last");
+  std::vector<size_t> prefixHashes = name.getPrefixHashes();
+  BOOST_REQUIRE_EQUAL(prefixHashes.size(), 4);
+
+  BOOST_CHECK_EQUAL(name.getPrefixHash(0), 0);
+  BOOST_CHECK_EQUAL(name.getPrefixHash(3), std::hash<Name>()(name));
+  for (size_t i = 0; i < name.size(); ++i) {
+    BOOST_CHECK_EQUAL(name.getComponentHash(i), std::hash<name::Component>()(name.get(i)));
+    BOOST_CHECK_EQUAL(name.getPrefixHash(i + 1), std::hash<Name>()(name.getPrefix(i + 1)));
+  }
+
+  // modification of a copy does not affect hashes of the original
+  Name copy = name;
+  copy.append("more");
+  BOOST_CHECK_EQUAL(copy.getPrefixHashes().size(), 5);
+  BOOST_CHECK_EQUAL(copy.getPrefixHash(3), prefixHashes[3]);
+  BOOST_CHECK_EQUAL(name.getPrefixHashes().size(), 4);
+
+  Name decoded(name.wireEncode());
+  BOOST_CHECK(decoded.getPrefixHashes() == prefixHashes);
+}
+
+BOOST_AUTO_TEST_CASE(HashesFromSeveralThreads)
+{
+  Name name("/first/second/last");
+  name.wireEncode();
+
+  // every thread gets the same cached instance
+  std::vector<const std::vector<size_t>*> results(8);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < results.size(); ++i) {
+    threads.push_back(std::thread([&name, &results, i] {
+          results[i] = &name.getPrefixHashes();
+        }));
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (const std::vector<size_t>* result : results) {
+    BOOST_CHECK_EQUAL(result, &name.getPrefixHashes());
+  }
+  BOOST_CHECK_EQUAL(name.getPrefixHash(3), std::hash<Name>()(Name("/first/second/last")));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
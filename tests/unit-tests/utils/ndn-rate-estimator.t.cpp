@@ -0,0 +1,90 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "utils/ndn-rate-estimator.hpp"
+
+#include <cmath>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsNdnRateEstimator)
+
+BOOST_AUTO_TEST_CASE(NoTraffic)
+{
+  RateEstimator estimator;
+  BOOST_CHECK_EQUAL(estimator.getAveragingPeriod(), Seconds(0.1));
+  BOOST_CHECK_EQUAL(estimator.getRate(Seconds(0)), 0.0);
+  BOOST_CHECK_EQUAL(estimator.getRate(Seconds(10)), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(Decay)
+{
+  RateEstimator estimator(Seconds(0.1));
+  estimator.add(1000, Seconds(1));
+
+  // each byte contributes with weight exp(-age / averagingPeriod)
+  BOOST_CHECK_CLOSE(estimator.getRate(Seconds(1)), 10000, 0.001);
+  BOOST_CHECK_CLOSE(estimator.getRate(Seconds(1.1)), 10000 * std::exp(-1), 0.001);
+  BOOST_CHECK_CLOSE(estimator.getRate(Seconds(1.3)), 10000 * std::exp(-3), 0.001);
+  BOOST_CHECK_LT(estimator.getRate(Seconds(3)), 0.001);
+
+  // estimate is not extrapolated into the past
+  BOOST_CHECK_CLOSE(estimator.getRate(Seconds(0.5)), 10000, 0.001);
+
+  // bytes observed later are added to the decayed sum
+  estimator.add(1000, Seconds(1.1));
+  BOOST_CHECK_CLOSE(estimator.getRate(Seconds(1.1)), 10000 * (1 + std::exp(-1)), 0.001);
+}
+
+BOOST_AUTO_TEST_CASE(ConstantRate)
+{
+  // 100 bytes every millisecond
+  RateEstimator estimator(Seconds(0.1));
+  for (int i = 0; i < 1000; ++i) {
+    estimator.add(100, MilliSeconds(i));
+  }
+  BOOST_CHECK_CLOSE(estimator.getRate(MilliSeconds(999)), 100000, 1);
+}
+
+BOOST_AUTO_TEST_CASE(SetAveragingPeriod)
+{
+  RateEstimator estimator(Seconds(0.1));
+  estimator.add(1000, Seconds(1));
+
+  // estimate does not jump when averaging period changes
+  estimator.setAveragingPeriod(Seconds(1));
+  BOOST_CHECK_EQUAL(estimator.getAveragingPeriod(), Seconds(1));
+  BOOST_CHECK_CLOSE(estimator.getRate(Seconds(1)), 10000, 0.001);
+
+  // and then decays with the new averaging period
+  BOOST_CHECK_CLOSE(estimator.getRate(Seconds(2)), 10000 * std::exp(-1), 0.001);
+
+  estimator.setAveragingPeriod(MilliSeconds(10));
+  BOOST_CHECK_CLOSE(estimator.getRate(Seconds(1)), 10000, 0.001);
+  BOOST_CHECK_CLOSE(estimator.getRate(Seconds(1.01)), 10000 * std::exp(-1), 0.001);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
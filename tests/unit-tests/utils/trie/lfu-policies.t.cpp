@@ -0,0 +1,180 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "utils/trie/trie-with-policy.hpp"
+#include "utils/trie/lfu-policy.hpp"
+#include "utils/trie/bucket-lfu-policy.hpp"
+#include "utils/trie/tiny-lfu-policy.hpp"
+
+#include <random>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+struct Item {
+};
+
+template<class PolicyTraits>
+class Cache {
+public:
+  explicit
+  Cache(size_t maxSize)
+    : m_items(1000)
+  {
+    m_trie.getPolicy().set_max_size(maxSize);
+  }
+
+  /**
+   * @brief Access item number i, inserting it on miss
+   * @return whether access was a hit
+   */
+  bool
+  access(const Name& prefix, size_t i)
+  {
+    Name name = Name(prefix).appendNumber(i);
+    auto item = m_trie.longest_prefix_match(name);
+    if (item != m_trie.end() && item->payload() == &m_items[i]) {
+      return true;
+    }
+    m_trie.insert(name, &m_items[i]);
+    return false;
+  }
+
+  bool
+  contains(const Name& prefix, size_t i)
+  {
+    return m_trie.find_exact(Name(prefix).appendNumber(i)) != m_trie.end();
+  }
+
+  std::set<size_t>
+  getContents() const
+  {
+    std::set<size_t> contents;
+    for (const auto& node : m_trie.getPolicy()) {
+      contents.insert(node.payload() - &m_items.front());
+    }
+    return contents;
+  }
+
+  size_t
+  size() const
+  {
+    return m_trie.getPolicy().size();
+  }
+
+public:
+  trie_with_policy<Name, pointer_payload_traits<Item>, PolicyTraits> m_trie;
+
+private:
+  std::vector<Item> m_items;
+};
+
+BOOST_AUTO_TEST_SUITE(UtilsTrieLfuPolicies)
+
+BOOST_AUTO_TEST_CASE(BucketLfuEviction)
+{
+  Cache<bucket_lfu_policy_traits> cache(3);
+  cache.access("/a", 1);
+  cache.access("/a", 2);
+  cache.access("/a", 3);
+  BOOST_CHECK(cache.access("/a", 1));
+  BOOST_CHECK(cache.access("/a", 1));
+  BOOST_CHECK(cache.access("/a", 2));
+
+  // 3 is the least frequently used
+  cache.access("/a", 4);
+  BOOST_CHECK(!cache.contains("/a", 3));
+
+  // among equally frequently used, the least recently used is evicted
+  cache.access("/a", 5);
+  BOOST_CHECK(!cache.contains("/a", 4));
+  BOOST_CHECK(cache.contains("/a", 1));
+  BOOST_CHECK(cache.contains("/a", 2));
+  BOOST_CHECK(cache.contains("/a", 5));
+}
+
+BOOST_AUTO_TEST_CASE(BucketLfuSameAsLfu)
+{
+  Cache<lfu_policy_traits> lfu(50);
+  Cache<bucket_lfu_policy_traits> bucketLfu(50);
+
+  std::mt19937 generator(1);
+  std::uniform_int_distribution<size_t> distribution(0, 999);
+  for (size_t i = 0; i < 20000; ++i) {
+    // mix of a popular and an unpopular range
+    size_t item = distribution(generator) % (i % 3 == 0 ? 1000 : 80);
+    BOOST_REQUIRE_EQUAL(lfu.access("/a", item), bucketLfu.access("/a", item));
+  }
+  BOOST_CHECK_EQUAL(bucketLfu.size(), 50);
+  BOOST_CHECK(lfu.getContents() == bucketLfu.getContents());
+}
+
+BOOST_AUTO_TEST_CASE(WTinyLfuScanResistance)
+{
+  Cache<tiny_lfu_policy_traits> cache(100);
+  for (size_t round = 0; round < 5; ++round) {
+    for (size_t i = 0; i < 50; ++i) {
+      cache.access("/hot", i);
+    }
+  }
+
+  // one-time accesses do not displace frequently used items
+  for (size_t i = 0; i < 1000; ++i) {
+    cache.access("/scan", i);
+    BOOST_REQUIRE_LE(cache.size(), 100);
+  }
+  size_t nHot = 0;
+  for (size_t i = 0; i < 50; ++i) {
+    nHot += cache.contains("/hot", i);
+  }
+  // the last hot item was still in the window, and may lose to a sketch collision
+  BOOST_CHECK_GE(nHot, 49);
+  BOOST_CHECK_EQUAL(cache.size(), 100);
+}
+
+BOOST_AUTO_TEST_CASE(WTinyLfuMaxSize)
+{
+  Cache<tiny_lfu_policy_traits> cache(100);
+  for (size_t i = 0; i < 200; ++i) {
+    cache.access("/a", i);
+  }
+  BOOST_CHECK_EQUAL(cache.size(), 100);
+
+  cache.m_trie.getPolicy().set_max_size(10);
+  cache.access("/b", 0);
+  BOOST_CHECK_EQUAL(cache.size(), 10);
+  BOOST_CHECK(cache.contains("/b", 0));
+
+  cache.m_trie.clear();
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+  for (size_t i = 0; i < 20; ++i) {
+    cache.access("/c", i);
+  }
+  BOOST_CHECK_EQUAL(cache.size(), 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndnSIM
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,237 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "utils/trie/detail/trie-children.hpp"
+
+#include <set>
+#include <vector>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+struct Node {
+  int key;
+  std::size_t hash;
+};
+
+typedef detail::trie_children<Node> Children;
+
+/**
+ * @brief Children of one node, with control over the hash of each child
+ */
+class ChildrenFixture {
+public:
+  ChildrenFixture()
+    : m_nodes(100)
+  {
+  }
+
+  Node&
+  insert(int key, std::size_t hash)
+  {
+    Node& node = m_nodes[key];
+    node.key = key;
+    node.hash = hash;
+    m_children.insert(&node, hash);
+    m_keys.insert(key);
+    return node;
+  }
+
+  void
+  erase(int key)
+  {
+    m_children.erase(m_nodes[key], m_nodes[key].hash);
+    m_keys.erase(key);
+  }
+
+  Node*
+  find(int key, std::size_t hash) const
+  {
+    return m_children.find(key, hash, [] (int key, const Node& node) { return node.key == key; });
+  }
+
+  /**
+   * @brief Check that exactly the inserted and not erased children are found and iterated
+   */
+  void
+  checkContents() const
+  {
+    BOOST_CHECK_EQUAL(m_children.size(), m_keys.size());
+
+    std::multiset<int> iterated;
+    for (const Node& node : m_children) {
+      iterated.insert(node.key);
+    }
+    BOOST_CHECK_EQUAL_COLLECTIONS(iterated.begin(), iterated.end(), m_keys.begin(), m_keys.end());
+
+    for (int key : m_keys) {
+      const Node& node = m_nodes[key];
+      BOOST_CHECK_EQUAL(find(key, node.hash), &node);
+      BOOST_CHECK_EQUAL(&*m_children.iterator_to(node, node.hash), &node);
+    }
+  }
+
+public:
+  std::vector<Node> m_nodes;
+  Children m_children;
+  std::set<int> m_keys;
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTrieChildren, ChildrenFixture)
+
+BOOST_AUTO_TEST_CASE(SwitchRepresentation)
+{
+  BOOST_CHECK_EQUAL(m_children.capacity(), 0);
+  BOOST_CHECK(m_children.begin() == m_children.end());
+
+  for (int key = 0; key < static_cast<int>(Children::SMALL_CAPACITY); ++key) {
+    insert(key, 1000 - key);
+    BOOST_CHECK(!m_children.is_hashed());
+  }
+  BOOST_CHECK_EQUAL(m_children.capacity(), Children::SMALL_CAPACITY);
+  checkContents();
+
+  // one more child switches to the hash table
+  insert(Children::SMALL_CAPACITY, 0);
+  BOOST_CHECK(m_children.is_hashed());
+  checkContents();
+
+  for (int key = Children::SMALL_CAPACITY + 1; key < 40; ++key) {
+    insert(key, key * 7);
+  }
+  BOOST_CHECK(m_children.is_hashed());
+  BOOST_CHECK_GE(m_children.capacity() * 3, m_children.size() * 4);
+  checkContents();
+
+  // the table shrinks while more than SMALL_CAPACITY / 2 children are left
+  for (int key = 39; key > static_cast<int>(Children::SMALL_CAPACITY / 2); --key) {
+    erase(key);
+    BOOST_CHECK(m_children.is_hashed());
+    BOOST_CHECK_GE(m_children.size() * 8, m_children.capacity());
+  }
+  checkContents();
+
+  // and switches back to the sorted array at SMALL_CAPACITY / 2 children
+  erase(Children::SMALL_CAPACITY / 2);
+  BOOST_CHECK(!m_children.is_hashed());
+  BOOST_CHECK_EQUAL(m_children.capacity(), Children::SMALL_CAPACITY);
+  checkContents();
+
+  for (int key = Children::SMALL_CAPACITY / 2 - 1; key >= 0; --key) {
+    erase(key);
+    checkContents();
+  }
+  BOOST_CHECK_EQUAL(m_children.capacity(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(EraseWrappingAround)
+{
+  // capacity of the table is 32 for 9..23 children
+  const std::size_t capacity = 32;
+  std::vector<std::pair<int, std::size_t>> children = {
+    // probe sequences starting near the end of the table wrap around to its beginning
+    {0, capacity - 2}, {1, 2 * capacity - 2}, {2, 3 * capacity - 2}, {3, capacity - 1},
+    {4, capacity}, {5, 2 * capacity + 1},
+    // children elsewhere in the table
+    {6, 8}, {7, 12}, {8, 16}, {9, 20},
+  };
+
+  for (size_t erased = 0; erased < children.size(); ++erased) {
+    ChildrenFixture fixture;
+    for (const auto& child : children) {
+      fixture.insert(child.first, child.second);
+    }
+    BOOST_REQUIRE(fixture.m_children.is_hashed());
+    BOOST_REQUIRE_EQUAL(fixture.m_children.capacity(), capacity);
+
+    fixture.erase(children[erased].first);
+    fixture.checkContents();
+
+    // erase the rest in order, keeping the table from shrinking below 5 children
+    for (size_t i = 0; i < children.size() && fixture.m_children.size() > 5; ++i) {
+      if (i != erased) {
+        fixture.erase(children[i].first);
+        fixture.checkContents();
+      }
+    }
+    BOOST_CHECK(fixture.m_children.is_hashed());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(EqualHashes)
+{
+  // in the sorted array
+  insert(0, 5);
+  insert(1, 7);
+  insert(2, 7);
+  insert(3, 7);
+  insert(4, 9);
+  BOOST_CHECK(!m_children.is_hashed());
+  checkContents();
+  BOOST_CHECK(find(5, 7) == 0);
+
+  erase(2);
+  checkContents();
+
+  // in the hash table
+  for (int key = 10; key < 20; ++key) {
+    insert(key, 7);
+  }
+  BOOST_CHECK(m_children.is_hashed());
+  checkContents();
+  BOOST_CHECK(find(5, 7) == 0);
+
+  erase(1);
+  erase(15);
+  checkContents();
+  erase(10);
+  erase(19);
+  checkContents();
+}
+
+BOOST_AUTO_TEST_CASE(IterationAfterErase)
+{
+  for (int key = 0; key < 30; ++key) {
+    insert(key, key % 3 == 0 ? 1 : key);
+  }
+
+  for (int key = 0; key < 30; key += 2) {
+    erase(key);
+
+    // iterating from iterator_to visits the child and then a part of the others
+    for (int other : m_keys) {
+      Children::iterator i = m_children.iterator_to(m_nodes[other], m_nodes[other].hash);
+      BOOST_CHECK_EQUAL(i->key, other);
+      BOOST_CHECK_LE(std::distance(i, m_children.end()), m_children.size());
+    }
+    checkContents();
+  }
+
+  BOOST_CHECK_EQUAL(std::distance(m_children.begin(), m_children.end()), 15);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndnSIM
+} // namespace ndn
+} // namespace ns3
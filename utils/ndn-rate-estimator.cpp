@@ -0,0 +1,76 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-rate-estimator.hpp"
+
+#include "ns3/assert.h"
+
+#include <cmath>
+
+namespace ns3 {
+namespace ndn {
+
+RateEstimator::RateEstimator(const Time& averagingPeriod)
+  : m_averagingPeriod(averagingPeriod)
+  , m_sum(0.0)
+  , m_lastUpdate(0)
+{
+  NS_ASSERT_MSG(m_averagingPeriod.IsStrictlyPositive(), "Averaging period must be positive");
+}
+
+void
+RateEstimator::add(uint32_t bytes, const Time& now)
+{
+  m_sum = getDecayedSum(now) + bytes;
+  m_lastUpdate = now;
+}
+
+double
+RateEstimator::getRate(const Time& now) const
+{
+  return getDecayedSum(now) / m_averagingPeriod.GetSeconds();
+}
+
+void
+RateEstimator::setAveragingPeriod(const Time& averagingPeriod)
+{
+  NS_ASSERT_MSG(averagingPeriod.IsStrictlyPositive(), "Averaging period must be positive");
+
+  // rescale the sum, so that the rate estimate does not jump
+  m_sum = m_sum * averagingPeriod.GetSeconds() / m_averagingPeriod.GetSeconds();
+  m_averagingPeriod = averagingPeriod;
+}
+
+const Time&
+RateEstimator::getAveragingPeriod() const
+{
+  return m_averagingPeriod;
+}
+
+double
+RateEstimator::getDecayedSum(const Time& now) const
+{
+  if (now <= m_lastUpdate) {
+    return m_sum;
+  }
+  return m_sum * std::exp(-(now - m_lastUpdate).GetSeconds() / m_averagingPeriod.GetSeconds());
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_RATE_ESTIMATOR_H
+#define NDN_RATE_ESTIMATOR_H
+
+#include "ns3/nstime.h"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-face
+ * @brief Exponentially weighted moving average of traffic rate
+ *
+ * The estimator keeps an exponentially decaying sum of observed bytes, so that each byte
+ * contributes to the rate with weight exp(-age / averagingPeriod).  The estimate requires O(1)
+ * memory and time per observation, and it decays to zero when no traffic is observed.  Under a
+ * constant rate, the estimate converges to that rate after a few averaging periods.
+ */
+class RateEstimator {
+public:
+  explicit RateEstimator(const Time& averagingPeriod = Seconds(0.1));
+
+  /**
+   * @brief Record \p bytes observed at time \p now
+   */
+  void
+  add(uint32_t bytes, const Time& now);
+
+  /**
+   * @brief Get estimated rate at time \p now, in bytes per second
+   */
+  double
+  getRate(const Time& now) const;
+
+  /**
+   * @brief Change averaging period, keeping the current estimate
+   */
+  void
+  setAveragingPeriod(const Time& averagingPeriod);
+
+  const Time&
+  getAveragingPeriod() const;
+
+private:
+  /**
+   * @brief Get decayed sum of bytes at time \p now
+   */
+  double
+  getDecayedSum(const Time& now) const;
+
+private:
+  Time m_averagingPeriod;
+  double m_sum;      ///< @brief decayed sum of bytes at m_lastUpdate
+  Time m_lastUpdate;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_RATE_ESTIMATOR_H
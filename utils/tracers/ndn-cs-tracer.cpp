@@ -26,6 +26,7 @@
 
 #include "apps/ndn-app.hpp"
 #include "model/cs/ndn-content-store.hpp"
+#include "model/ndn-l3-protocol.hpp"
 #include "ns3/simulator.h"
 #include "ns3/node-list.h"
 #include "ns3/log.h"
@@ -200,9 +201,12 @@ CsTracer::~CsTracer(){};
 void
 CsTracer::Connect()
 {
+  // hits and misses are traced only for old content store implementations
   Ptr<ContentStore> cs = m_nodePtr->GetObject<ContentStore>();
-  cs->TraceConnectWithoutContext("CacheHits", MakeCallback(&CsTracer::CacheHits, this));
-  cs->TraceConnectWithoutContext("CacheMisses", MakeCallback(&CsTracer::CacheMisses, this));
+  if (cs != 0) {
+    cs->TraceConnectWithoutContext("CacheHits", MakeCallback(&CsTracer::CacheHits, this));
+    cs->TraceConnectWithoutContext("CacheMisses", MakeCallback(&CsTracer::CacheMisses, this));
+  }
 
   Reset();
 }
@@ -236,6 +240,8 @@ CsTracer::PrintHeader(std::ostream& os) const
      << "Type"
      << "\t"
      << "Packets"
+     << "\t"
+     << "Bytes"
      << "\t";
 }
 
@@ -245,23 +251,37 @@ CsTracer::Reset()
   m_stats.Reset();
 }
 
-#define PRINTER(printName, fieldName)                                                              \
-  os << time.ToDouble(Time::S) << "\t" << m_node << "\t" << printName << "\t" << m_stats.fieldName \
-     << "\n";
+#define PRINTER(printName, packets, bytes)                                                         \
+  os << time.ToDouble(Time::S) << "\t" << m_node << "\t" << printName << "\t" << packets << "\t"    \
+     << bytes << "\n";
 
 void
 CsTracer::Print(std::ostream& os) const
 {
   Time time = Simulator::Now();
 
-  PRINTER("CacheHits", m_cacheHits);
-  PRINTER("CacheMisses", m_cacheMisses);
+  PRINTER("CacheHits", m_stats.m_cacheHits, m_stats.m_cacheHitBytes);
+  PRINTER("CacheMisses", m_stats.m_cacheMisses, 0);
+
+  // current occupancy of the content store
+  Ptr<ContentStore> cs = m_nodePtr->GetObject<ContentStore>();
+  if (cs != 0) {
+    PRINTER("CacheSize", cs->GetSize(), cs->GetSizeInBytes());
+  }
+  else {
+    Ptr<L3Protocol> l3 = m_nodePtr->GetObject<L3Protocol>();
+    if (l3 != 0) {
+      const nfd::Cs& nfdCs = l3->getForwarder()->getCs();
+      PRINTER("CacheSize", nfdCs.size(), nfdCs.getNBytes());
+    }
+  }
 }
 
 void
-CsTracer::CacheHits(shared_ptr<const Interest>, shared_ptr<const Data>)
+CsTracer::CacheHits(shared_ptr<const Interest>, shared_ptr<const Data> data)
 {
   m_stats.m_cacheHits++;
+  m_stats.m_cacheHitBytes += data->wireEncode().size();
 }
 
 void
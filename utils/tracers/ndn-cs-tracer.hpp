@@ -47,9 +47,11 @@ struct Stats {
   Reset()
   {
     m_cacheHits = 0;
+    m_cacheHitBytes = 0;
     m_cacheMisses = 0;
   }
   double m_cacheHits;
+  double m_cacheHitBytes;
   double m_cacheMisses;
 };
 /// @endcond
@@ -57,7 +59,11 @@ struct Stats {
 
 /**
  * @ingroup ndn-tracers
- * @brief NDN tracer for cache performance (hits and misses)
+ * @brief NDN tracer for cache performance (hits and misses) and content store occupancy
+ *
+ * Each period, the tracer prints CacheHits (number and total size of Data packets served),
+ * CacheMisses, and CacheSize (number and total size of Data packets stored at the end of the
+ * period).  Hits and misses are traced only for old content store implementations.
  */
 class CsTracer : public SimpleRefCount<CsTracer> {
 public:
@@ -0,0 +1,259 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#ifndef BUCKET_LFU_POLICY_H_
+#define BUCKET_LFU_POLICY_H_
+
+/// @cond include_hidden
+
+#include <boost/intrusive/options.hpp>
+#include <boost/intrusive/list.hpp>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Traits for LFU replacement policy with constant-time operations
+ *
+ * Items are kept in one list sorted by access frequency, and within the same frequency, by
+ * recency of the last access.  Items with the same frequency form a bucket; each bucket knows
+ * its last item, so that an accessed item is moved to the end of the next bucket in O(1)
+ * instead of being re-inserted into a tree as in lfu_policy_traits.  Eviction order is the
+ * same as in lfu_policy_traits.
+ */
+struct bucket_lfu_policy_traits {
+  /// @brief Name that can be used to identify the policy (for NS-3 object model and logging)
+  static std::string
+  GetName()
+  {
+    return "BucketLfu";
+  }
+
+  struct policy_hook_type : public boost::intrusive::list_member_hook<> {
+    void* bucket; // frequency bucket of the item
+  };
+
+  template<class Container>
+  struct container_hook {
+    typedef boost::intrusive::member_hook<Container, policy_hook_type, &Container::policy_hook_>
+      type;
+  };
+
+  template<class Base, class Container, class Hook>
+  struct policy {
+    typedef typename boost::intrusive::list<Container, Hook> policy_container;
+
+    /**
+     * @brief Group of items with the same access frequency
+     */
+    struct bucket : public boost::intrusive::list_base_hook<> {
+      explicit bucket(size_t frequency)
+        : frequency(frequency)
+        , size(0)
+        , last(0)
+      {
+      }
+
+      size_t frequency;
+      size_t size;
+      Container* last; ///< most recently accessed item in the bucket
+    };
+
+    typedef boost::intrusive::list<bucket> bucket_list;
+
+    struct bucket_disposer {
+      void
+      operator()(bucket* b)
+      {
+        delete b;
+      }
+    };
+
+    static bucket*
+    get_bucket(typename Container::iterator item)
+    {
+      return static_cast<bucket*>(
+        static_cast<policy_hook_type*>(policy_container::value_traits::to_node_ptr(*item))
+          ->bucket);
+    }
+
+    static void
+    set_bucket(typename Container::iterator item, bucket* b)
+    {
+      static_cast<policy_hook_type*>(policy_container::value_traits::to_node_ptr(*item))->bucket = b;
+    }
+
+    // could be just typedef
+    class type : public policy_container {
+    public:
+      typedef policy policy_base; // to get access to get_bucket method from outside
+      typedef Container parent_trie;
+
+      type(Base& base)
+        : base_(base)
+        , max_size_(100)
+      {
+      }
+
+      ~type()
+      {
+        buckets_.clear_and_dispose(bucket_disposer());
+      }
+
+      inline void
+      update(typename parent_trie::iterator item)
+      {
+        increment(item);
+      }
+
+      inline bool
+      insert(typename parent_trie::iterator item)
+      {
+        if (max_size_ != 0 && policy_container::size() >= max_size_) {
+          // this erases the "least frequently used item" from cache
+          base_.erase(&(*policy_container::begin()));
+        }
+
+        bucket* first = buckets_.empty() ? 0 : &buckets_.front();
+        if (first == 0 || first->frequency != 1) {
+          first = new bucket(1);
+          buckets_.push_front(*first);
+        }
+
+        if (first->last == 0) {
+          policy_container::push_front(*item);
+        }
+        else {
+          policy_container::insert(++policy_container::s_iterator_to(*first->last), *item);
+        }
+        link(item, first);
+        return true;
+      }
+
+      inline void
+      lookup(typename parent_trie::iterator item)
+      {
+        increment(item);
+      }
+
+      inline void
+      erase(typename parent_trie::iterator item)
+      {
+        bucket* b = get_bucket(item);
+        unlink(item, b);
+        policy_container::erase(policy_container::s_iterator_to(*item));
+        dispose_if_empty(b);
+      }
+
+      inline void
+      clear()
+      {
+        policy_container::clear();
+        buckets_.clear_and_dispose(bucket_disposer());
+      }
+
+      inline void
+      set_max_size(size_t max_size)
+      {
+        max_size_ = max_size;
+      }
+
+      inline size_t
+      get_max_size() const
+      {
+        return max_size_;
+      }
+
+    private:
+      /**
+       * @brief Move item to the end of the bucket with the next frequency
+       */
+      void
+      increment(typename parent_trie::iterator item)
+      {
+        bucket* b = get_bucket(item);
+        typename bucket_list::iterator next = ++bucket_list::s_iterator_to(*b);
+
+        bucket* target = 0;
+        if (next != buckets_.end() && next->frequency == b->frequency + 1) {
+          target = &*next;
+        }
+        else {
+          target = new bucket(b->frequency + 1);
+          buckets_.insert(next, *target);
+        }
+
+        // new position is after the last item of the target bucket, which immediately follows
+        // the current bucket
+        Container* after = target->last != 0 ? target->last : b->last;
+        unlink(item, b);
+        if (after != &(*item)) {
+          policy_container::splice(++policy_container::s_iterator_to(*after), *this,
+                                   policy_container::s_iterator_to(*item));
+        }
+        link(item, target);
+        dispose_if_empty(b);
+      }
+
+      void
+      link(typename parent_trie::iterator item, bucket* b)
+      {
+        set_bucket(item, b);
+        b->last = &(*item);
+        ++b->size;
+      }
+
+      void
+      unlink(typename parent_trie::iterator item, bucket* b)
+      {
+        if (b->last == &(*item)) {
+          b->last = b->size > 1 ? &(*--policy_container::s_iterator_to(*item)) : 0;
+        }
+        --b->size;
+      }
+
+      void
+      dispose_if_empty(bucket* b)
+      {
+        if (b->size == 0) {
+          buckets_.erase_and_dispose(bucket_list::s_iterator_to(*b), bucket_disposer());
+        }
+      }
+
+    private:
+      type()
+        : base_(*((Base*)0)){};
+
+    private:
+      Base& base_;
+      size_t max_size_;
+      bucket_list buckets_;
+    };
+  };
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // BUCKET_LFU_POLICY_H
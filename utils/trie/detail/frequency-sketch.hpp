@@ -0,0 +1,140 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#ifndef FREQUENCY_SKETCH_H_
+#define FREQUENCY_SKETCH_H_
+
+/// @cond include_hidden
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+namespace detail {
+
+/**
+ * @brief Count-min sketch estimating recent access frequency of keys, given their hashes
+ *
+ * Counters saturate at 15.  After the number of increments reaches ten times the capacity,
+ * all counters are halved, so that the estimate reflects recent popularity.
+ */
+class frequency_sketch {
+public:
+  static const uint8_t MAX_COUNT = 15;
+  static const size_t DEPTH = 4;
+
+  frequency_sketch()
+    : mask_(0)
+    , sample_size_(0)
+    , additions_(0)
+  {
+  }
+
+  /**
+   * @brief Allocate counters for a cache of @p capacity items, resetting all estimates
+   */
+  void
+  resize(size_t capacity)
+  {
+    capacity = std::max<size_t>(capacity, 16);
+    // four counters per item in each row keep collisions rare
+    size_t width = 1;
+    while (width < 4 * capacity) {
+      width <<= 1;
+    }
+
+    table_.assign(width * DEPTH, 0);
+    mask_ = width - 1;
+    sample_size_ = 10 * capacity;
+    additions_ = 0;
+  }
+
+  void
+  increment(size_t hash)
+  {
+    bool isAdded = false;
+    for (size_t row = 0; row < DEPTH; ++row) {
+      uint8_t& counter = table_[index(hash, row)];
+      if (counter < MAX_COUNT) {
+        ++counter;
+        isAdded = true;
+      }
+    }
+
+    if (isAdded && ++additions_ >= sample_size_) {
+      age();
+    }
+  }
+
+  uint8_t
+  estimate(size_t hash) const
+  {
+    uint8_t count = MAX_COUNT;
+    for (size_t row = 0; row < DEPTH; ++row) {
+      count = std::min(count, table_[index(hash, row)]);
+    }
+    return count;
+  }
+
+  void
+  clear()
+  {
+    std::fill(table_.begin(), table_.end(), 0);
+    additions_ = 0;
+  }
+
+private:
+  size_t
+  index(size_t hash, size_t row) const
+  {
+    // double hashing over a scrambled hash: rows use independent-enough indices
+    uint64_t h = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL;
+    uint64_t h1 = h ^ (h >> 32);
+    uint64_t h2 = (h >> 17) | 1;
+    return row * (mask_ + 1) + ((h1 + row * h2) & mask_);
+  }
+
+  void
+  age()
+  {
+    for (uint8_t& counter : table_) {
+      counter >>= 1;
+    }
+    additions_ /= 2;
+  }
+
+private:
+  std::vector<uint8_t> table_;
+  size_t mask_;
+  size_t sample_size_;
+  size_t additions_;
+};
+
+} // detail
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // FREQUENCY_SKETCH_H_
@@ -0,0 +1,415 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef TRIE_CHILDREN_H_
+#define TRIE_CHILDREN_H_
+
+/// @cond include_hidden
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+namespace detail {
+
+/**
+ * @brief Set of child nodes of a trie node, keyed by hash of the key component
+ *
+ * The representation adapts to the number of children:
+ * - no children: nothing is allocated, which is the case for most nodes (leaves);
+ * - up to SMALL_CAPACITY children: a flat array sorted by hash, searched linearly;
+ * - more children: an open addressing hash table with linear probing.
+ *
+ * In either case, all children are referenced from one contiguous array of (hash, node)
+ * slots, so that a lookup compares cached hashes before touching any child node.
+ * The container does not own the nodes.
+ *
+ * The sorted array is allocated separately rather than embedded in the container: embedded
+ * slots would be paid for by every leaf, and with SMALL_CAPACITY of them the trie in
+ * ndn-trie-benchmark grows from 323 to 444 bytes per entry.
+ */
+template<class Node>
+class trie_children {
+public:
+  static const uint32_t SMALL_CAPACITY = 8;
+
+  struct slot {
+    std::size_t hash;
+    Node* node; ///< 0 for empty slots of the hash table
+  };
+
+  /**
+   * @brief Forward iterator over child nodes (order is not defined)
+   */
+  class iterator {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef Node value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef Node* pointer;
+    typedef Node& reference;
+
+    iterator()
+      : slot_(0)
+      , end_(0)
+    {
+    }
+
+    iterator(slot* position, slot* end)
+      : slot_(position)
+      , end_(end)
+    {
+      skip_empty();
+    }
+
+    Node& operator*() const
+    {
+      return *slot_->node;
+    }
+
+    Node* operator->() const
+    {
+      return slot_->node;
+    }
+
+    iterator&
+    operator++()
+    {
+      ++slot_;
+      skip_empty();
+      return *this;
+    }
+
+    iterator
+    operator++(int)
+    {
+      iterator i = *this;
+      ++(*this);
+      return i;
+    }
+
+    bool
+    operator==(const iterator& other) const
+    {
+      return slot_ == other.slot_;
+    }
+
+    bool
+    operator!=(const iterator& other) const
+    {
+      return slot_ != other.slot_;
+    }
+
+  private:
+    void
+    skip_empty()
+    {
+      while (slot_ != end_ && slot_->node == 0) {
+        ++slot_;
+      }
+    }
+
+  private:
+    slot* slot_;
+    slot* end_;
+  };
+
+  typedef iterator const_iterator;
+
+  trie_children()
+    : slots_(0)
+    , size_(0)
+    , capacity_(0)
+  {
+  }
+
+  ~trie_children()
+  {
+    delete[] slots_;
+  }
+
+  trie_children(const trie_children&) = delete;
+
+  trie_children&
+  operator=(const trie_children&) = delete;
+
+  size_t
+  size() const
+  {
+    return size_;
+  }
+
+  bool
+  empty() const
+  {
+    return size_ == 0;
+  }
+
+  /**
+   * @brief Number of allocated slots
+   */
+  size_t
+  capacity() const
+  {
+    return capacity_;
+  }
+
+  /**
+   * @brief Whether children are kept in a hash table (as opposed to the small sorted array)
+   */
+  bool
+  is_hashed() const
+  {
+    return capacity_ > SMALL_CAPACITY;
+  }
+
+  iterator
+  begin() const
+  {
+    return iterator(slots_, slots_ + used_end());
+  }
+
+  iterator
+  end() const
+  {
+    return iterator(slots_ + used_end(), slots_ + used_end());
+  }
+
+  /**
+   * @brief Find child with key equal to @p key, given its hash
+   * @param equal predicate invoked as equal(key, node) for children with the same hash
+   * @return the child, or 0 if not found
+   */
+  template<class Key, class Equal>
+  Node*
+  find(const Key& key, std::size_t hash, Equal equal) const
+  {
+    if (!is_hashed()) {
+      for (slot* i = slots_; i != slots_ + size_ && i->hash <= hash; ++i) {
+        if (i->hash == hash && equal(key, *i->node))
+          return i->node;
+      }
+      return 0;
+    }
+
+    size_t mask = capacity_ - 1;
+    for (size_t i = hash & mask; slots_[i].node != 0; i = (i + 1) & mask) {
+      if (slots_[i].hash == hash && equal(key, *slots_[i].node))
+        return slots_[i].node;
+    }
+    return 0;
+  }
+
+  /**
+   * @brief Get iterator pointing to @p node, which must be a child with hash @p hash
+   */
+  iterator
+  iterator_to(const Node& node, std::size_t hash) const
+  {
+    return iterator(locate(node, hash), slots_ + used_end());
+  }
+
+  /**
+   * @brief Add @p node with hash @p hash; the caller ensures there is no such child yet
+   */
+  void
+  insert(Node* node, std::size_t hash)
+  {
+    if (!is_hashed()) {
+      if (size_ == SMALL_CAPACITY) {
+        reallocate(SMALL_CAPACITY * 4);
+      }
+      else {
+        if (size_ == capacity_) {
+          reallocate(capacity_ == 0 ? 1 : capacity_ * 2);
+        }
+        slot* position = std::upper_bound(slots_, slots_ + size_, hash, slot_hash_less());
+        std::copy_backward(position, slots_ + size_, slots_ + size_ + 1);
+        position->hash = hash;
+        position->node = node;
+        ++size_;
+        return;
+      }
+    }
+    else if ((size_ + 1) * 4 > capacity_ * 3) {
+      reallocate(capacity_ * 2);
+    }
+
+    insert_hashed(node, hash);
+    ++size_;
+  }
+
+  /**
+   * @brief Remove @p node, which must be a child with hash @p hash
+   */
+  void
+  erase(const Node& node, std::size_t hash)
+  {
+    slot* position = locate(node, hash);
+    --size_;
+
+    if (!is_hashed()) {
+      std::copy(position + 1, slots_ + size_ + 1, position);
+      if (size_ == 0) {
+        reallocate(0);
+      }
+      return;
+    }
+
+    // backward shift deletion keeps probe sequences intact without tombstones
+    size_t mask = capacity_ - 1;
+    size_t hole = position - slots_;
+    for (size_t i = (hole + 1) & mask; slots_[i].node != 0; i = (i + 1) & mask) {
+      size_t home = slots_[i].hash & mask;
+      // move the slot into the hole, unless its home lies cyclically within (hole, i]
+      if ((i > hole && (home <= hole || home > i)) || (i < hole && home <= hole && home > i)) {
+        slots_[hole] = slots_[i];
+        hole = i;
+      }
+    }
+    slots_[hole].node = 0;
+
+    if (size_ <= SMALL_CAPACITY / 2) {
+      reallocate(SMALL_CAPACITY);
+    }
+    else if (size_ * 8 < capacity_) {
+      reallocate(capacity_ / 2);
+    }
+  }
+
+  /**
+   * @brief Remove all children, invoking @p disposer on each of them
+   */
+  template<class Disposer>
+  void
+  clear_and_dispose(Disposer disposer)
+  {
+    slot* slots = slots_;
+    size_t end = used_end();
+    slots_ = 0;
+    size_ = 0;
+    capacity_ = 0;
+
+    for (slot* i = slots; i != slots + end; ++i) {
+      if (i->node != 0)
+        disposer(i->node);
+    }
+    delete[] slots;
+  }
+
+private:
+  struct slot_hash_less {
+    bool
+    operator()(std::size_t hash, const slot& s) const
+    {
+      return hash < s.hash;
+    }
+  };
+
+  size_t
+  used_end() const
+  {
+    return is_hashed() ? capacity_ : size_;
+  }
+
+  slot*
+  locate(const Node& node, std::size_t hash) const
+  {
+    if (!is_hashed()) {
+      slot* i = std::lower_bound(slots_, slots_ + size_, hash,
+                                 [] (const slot& s, std::size_t h) { return s.hash < h; });
+      while (i->node != &node) {
+        ++i;
+      }
+      return i;
+    }
+
+    size_t mask = capacity_ - 1;
+    size_t i = hash & mask;
+    while (slots_[i].node != &node) {
+      i = (i + 1) & mask;
+    }
+    return slots_ + i;
+  }
+
+  void
+  insert_hashed(Node* node, std::size_t hash)
+  {
+    size_t mask = capacity_ - 1;
+    size_t i = hash & mask;
+    while (slots_[i].node != 0) {
+      i = (i + 1) & mask;
+    }
+    slots_[i].hash = hash;
+    slots_[i].node = node;
+  }
+
+  /**
+   * @brief Move children into a new array of @p capacity slots
+   *
+   * Capacity up to SMALL_CAPACITY selects the sorted array, larger capacity (a power of two)
+   * selects the hash table.
+   */
+  void
+  reallocate(uint32_t capacity)
+  {
+    slot* old = slots_;
+    size_t oldEnd = used_end();
+
+    slots_ = capacity > 0 ? new slot[capacity]() : 0;
+    capacity_ = capacity;
+
+    if (!is_hashed()) {
+      slot* out = slots_;
+      for (slot* i = old; i != old + oldEnd; ++i) {
+        if (i->node != 0)
+          *out++ = *i;
+      }
+      std::sort(slots_, out, [] (const slot& a, const slot& b) { return a.hash < b.hash; });
+    }
+    else {
+      for (slot* i = old; i != old + oldEnd; ++i) {
+        if (i->node != 0)
+          insert_hashed(i->node, i->hash);
+      }
+    }
+    delete[] old;
+  }
+
+private:
+  slot* slots_;
+  uint32_t size_;
+  uint32_t capacity_;
+};
+
+template<class Node>
+const uint32_t trie_children<Node>::SMALL_CAPACITY;
+
+} // namespace detail
+} // namespace ndnSIM
+} // namespace ndn
+} // namespace ns3
+
+/// @endcond
+
+#endif // TRIE_CHILDREN_H_
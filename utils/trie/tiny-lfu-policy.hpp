@@ -0,0 +1,302 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#ifndef TINY_LFU_POLICY_H_
+#define TINY_LFU_POLICY_H_
+
+/// @cond include_hidden
+
+#include "detail/frequency-sketch.hpp"
+
+#include <boost/intrusive/options.hpp>
+#include <boost/intrusive/list.hpp>
+#include <boost/functional/hash.hpp>
+
+#include <limits>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Traits for W-TinyLFU replacement policy
+ *
+ * New items enter a small LRU window (1% of capacity).  Items leaving the window compete for
+ * admission to the main cache, a segmented LRU of probation (20%) and protected (80%)
+ * segments, against the probation segment's LRU item: the one with higher access frequency
+ * stays, as estimated by a count-min sketch over recent inserts and hits.  The sketch is aged
+ * periodically, so that formerly popular items eventually lose their advantage.
+ *
+ * All operations take constant time.
+ */
+struct tiny_lfu_policy_traits {
+  /// @brief Name that can be used to identify the policy (for NS-3 object model and logging)
+  static std::string
+  GetName()
+  {
+    return "WTinyLfu";
+  }
+
+  struct policy_hook_type : public boost::intrusive::list_member_hook<> {
+    size_t hash;     // hash of the full name, key of the frequency sketch
+    uint8_t segment; // segment the item is in
+  };
+
+  template<class Container>
+  struct container_hook {
+    typedef boost::intrusive::member_hook<Container, policy_hook_type, &Container::policy_hook_>
+      type;
+  };
+
+  template<class Base, class Container, class Hook>
+  struct policy {
+    typedef typename boost::intrusive::list<Container, Hook> policy_container;
+
+    enum {
+      WINDOW,
+      PROBATION,
+      PROTECTED,
+      N_SEGMENTS
+    };
+
+    static policy_hook_type&
+    get_hook(Container& item)
+    {
+      return *static_cast<policy_hook_type*>(policy_container::value_traits::to_node_ptr(item));
+    }
+
+    /**
+     * @brief Hash of the full name of the item, obtained by walking up the trie
+     */
+    static size_t
+    get_name_hash(const Container& item)
+    {
+      size_t hash = 0;
+      for (const Container* node = &item; node != 0; node = node->parent()) {
+        boost::hash_combine(hash, hash_value(*node));
+      }
+      return hash;
+    }
+
+    // could be just typedef
+    //
+    // The items of all segments are kept in one list, window first, then probation, then
+    // protected, each segment ordered from least to most recently used
+    class type : public policy_container {
+    public:
+      typedef policy policy_base; // to get access to get_hook methods from outside
+      typedef Container parent_trie;
+
+      type(Base& base)
+        : base_(base)
+      {
+        std::fill_n(first_, static_cast<int>(N_SEGMENTS), static_cast<Container*>(0));
+        std::fill_n(size_, static_cast<int>(N_SEGMENTS), 0);
+        set_max_size(100);
+      }
+
+      inline void
+      update(typename parent_trie::iterator item)
+      {
+        touch(*item);
+      }
+
+      inline bool
+      insert(typename parent_trie::iterator item)
+      {
+        policy_hook_type& hook = get_hook(*item);
+        hook.hash = get_name_hash(*item);
+        sketch_.increment(hook.hash);
+
+        push(*item, WINDOW);
+
+        if (max_size_ != 0) {
+          while (size_[WINDOW] > max_window_size_) {
+            Container& candidate = *first_[WINDOW];
+            move(candidate, PROBATION);
+            if (policy_container::size() > max_size_) {
+              evict_or_reject(candidate);
+            }
+          }
+
+          // only when max size has been reduced; main cache cannot be empty here
+          while (policy_container::size() > max_size_) {
+            base_.erase(first_[PROBATION] != 0 ? first_[PROBATION] : first_[PROTECTED]);
+          }
+        }
+        return true;
+      }
+
+      inline void
+      lookup(typename parent_trie::iterator item)
+      {
+        touch(*item);
+      }
+
+      inline void
+      erase(typename parent_trie::iterator item)
+      {
+        unlink(*item);
+      }
+
+      inline void
+      clear()
+      {
+        policy_container::clear();
+        std::fill_n(first_, static_cast<int>(N_SEGMENTS), static_cast<Container*>(0));
+        std::fill_n(size_, static_cast<int>(N_SEGMENTS), 0);
+        sketch_.clear();
+      }
+
+      inline void
+      set_max_size(size_t max_size)
+      {
+        max_size_ = max_size;
+        if (max_size_ == 0) {
+          max_window_size_ = std::numeric_limits<size_t>::max();
+          max_protected_size_ = std::numeric_limits<size_t>::max();
+        }
+        else {
+          max_window_size_ = std::max<size_t>(max_size_ / 100, 1);
+          max_protected_size_ = (max_size_ - max_window_size_) * 4 / 5;
+        }
+        sketch_.resize(max_size_);
+      }
+
+      inline size_t
+      get_max_size() const
+      {
+        return max_size_;
+      }
+
+    private:
+      /**
+       * @brief Record access to the item, promoting it within the cache
+       */
+      void
+      touch(Container& item)
+      {
+        sketch_.increment(get_hook(item).hash);
+
+        switch (get_hook(item).segment) {
+        case WINDOW:
+          move(item, WINDOW);
+          break;
+        case PROBATION:
+          move(item, PROTECTED);
+          while (size_[PROTECTED] > max_protected_size_) {
+            move(*first_[PROTECTED], PROBATION);
+          }
+          break;
+        case PROTECTED:
+          move(item, PROTECTED);
+          break;
+        }
+      }
+
+      /**
+       * @brief Evict either the candidate that has just left the window, or the victim of
+       *        the main cache, whichever is less frequently used
+       */
+      void
+      evict_or_reject(Container& candidate)
+      {
+        Container* victim = first_[PROBATION];
+        if (victim == &candidate) {
+          victim = first_[PROTECTED];
+        }
+
+        if (victim == 0 ||
+            sketch_.estimate(get_hook(candidate).hash) <= sketch_.estimate(get_hook(*victim).hash)) {
+          base_.erase(&candidate);
+        }
+        else {
+          base_.erase(victim);
+        }
+      }
+
+      typename policy_container::iterator
+      segment_end(int segment)
+      {
+        for (int next = segment + 1; next < N_SEGMENTS; ++next) {
+          if (first_[next] != 0) {
+            return policy_container::s_iterator_to(*first_[next]);
+          }
+        }
+        return policy_container::end();
+      }
+
+      void
+      push(Container& item, int segment)
+      {
+        get_hook(item).segment = segment;
+        policy_container::insert(segment_end(segment), item);
+        if (first_[segment] == 0) {
+          first_[segment] = &item;
+        }
+        ++size_[segment];
+      }
+
+      void
+      unlink(Container& item)
+      {
+        int segment = get_hook(item).segment;
+        typename policy_container::iterator position = policy_container::s_iterator_to(item);
+        if (first_[segment] == &item) {
+          typename policy_container::iterator next = position;
+          ++next;
+          first_[segment] =
+            (next != policy_container::end() && get_hook(*next).segment == segment) ? &(*next) : 0;
+        }
+        policy_container::erase(position);
+        --size_[segment];
+      }
+
+      void
+      move(Container& item, int segment)
+      {
+        unlink(item);
+        push(item, segment);
+      }
+
+    private:
+      type()
+        : base_(*((Base*)0)){};
+
+    private:
+      Base& base_;
+      size_t max_size_;
+      size_t max_window_size_;
+      size_t max_protected_size_;
+
+      Container* first_[N_SEGMENTS]; ///< least recently used item of each segment
+      size_t size_[N_SEGMENTS];
+      detail::frequency_sketch sketch_;
+    };
+  };
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // TINY_LFU_POLICY_H
@@ -41,8 +41,8 @@ public:
                     typename PolicyTraits::template container_hook<parent_trie>::type>::type
       policy_container;
 
-  inline trie_with_policy(size_t bucketSize = 1, size_t bucketIncrement = 1)
-    : trie_(name::Component(), bucketSize, bucketIncrement)
+  inline trie_with_policy()
+    : trie_(name::Component())
     , policy_(*this)
   {
   }
@@ -26,11 +26,11 @@
 
 #include "ns3/ptr.h"
 
-#include <boost/intrusive/unordered_set.hpp>
+#include "detail/trie-children.hpp"
+
 #include <boost/intrusive/list.hpp>
 #include <boost/intrusive/set.hpp>
 #include <boost/functional/hash.hpp>
-#include <boost/interprocess/smart_ptr/unique_ptr.hpp>
 #include <tuple>
 #include <boost/foreach.hpp>
 #include <boost/mpl/if.hpp>
@@ -117,6 +117,25 @@ template<typename FullKey, typename PayloadTraits, typename PolicyHook>
 std::size_t
 hash_value(const trie<FullKey, PayloadTraits, PolicyHook>& trie_node);
 
+/**
+ * @brief Get hash of i-th component of the key, consistent with hash_value of the trie node
+ */
+template<typename FullKey>
+inline std::size_t
+key_component_hash(const FullKey& key, size_t i)
+{
+  return boost::hash_value(key[i]);
+}
+
+/**
+ * @brief Get hash of i-th component of the name, using hash value cached in the name
+ */
+inline std::size_t
+key_component_hash(const Name& key, size_t i)
+{
+  return key.getComponentHash(i);
+}
+
 ///////////////////////////////////////////////////
 // actual definition
 //
@@ -142,15 +161,9 @@ public:
 
   typedef PayloadTraits payload_traits;
 
-  inline trie(const Key& key, size_t bucketSize = 1, size_t bucketIncrement = 1)
+  inline explicit trie(const Key& key, std::size_t hash = 0)
     : key_(key)
-    , initialBucketSize_(bucketSize)
-    , bucketIncrement_(bucketIncrement)
-    , bucketSize_(initialBucketSize_)
-    , buckets_(new bucket_type[bucketSize_]) // cannot use normal pointer, because lifetime of
-                                             // buckets should be larger than lifetime of the
-                                             // container
-    , children_(bucket_traits(buckets_.get(), bucketSize_))
+    , hash_(hash)
     , payload_(PayloadTraits::empty_payload)
     , parent_(nullptr)
   {
@@ -195,29 +208,18 @@ public:
   {
     trie* trieNode = this;
 
-    BOOST_FOREACH (const Key& subkey, key) {
-      typename unordered_set::iterator item = trieNode->children_.find(subkey);
-      if (item == trieNode->children_.end()) {
-        trie* newNode = new trie(subkey, initialBucketSize_, bucketIncrement_);
-        // std::cout << "new " << newNode << "\n";
+    for (size_t i = 0; i < key.size(); ++i) {
+      const Key& subkey = key[i];
+      std::size_t subkeyHash = key_component_hash(key, i);
+      trie* item = trieNode->find_child(subkey, subkeyHash);
+      if (item == 0) {
+        trie* newNode = new trie(subkey, subkeyHash);
         newNode->parent_ = trieNode;
-
-        if (trieNode->children_.size() >= trieNode->bucketSize_) {
-          trieNode->bucketSize_ += trieNode->bucketIncrement_;
-          trieNode->bucketIncrement_ *= 2; // increase bucketIncrement exponentially
-
-          buckets_array newBuckets(new bucket_type[trieNode->bucketSize_]);
-          trieNode->children_.rehash(bucket_traits(newBuckets.get(), trieNode->bucketSize_));
-          trieNode->buckets_.swap(newBuckets);
-        }
-
-        std::pair<typename unordered_set::iterator, bool> ret =
-          trieNode->children_.insert(*newNode);
-
-        trieNode = &(*ret.first);
+        trieNode->children_.insert(newNode, subkeyHash);
+        trieNode = newNode;
       }
       else
-        trieNode = &(*item);
+        trieNode = item;
     }
 
     if (trieNode->payload_ == PayloadTraits::empty_payload) {
@@ -249,9 +251,8 @@ public:
         return this;
 
       trie* parent = parent_;
-      parent->children_
-        .erase_and_dispose(*this,
-                           trie_delete_disposer()); // delete this; basically, committing a suicide
+      parent->children_.erase(*this, hash_);
+      delete this; // basically, committing a suicide
 
       return parent->prune();
     }
@@ -269,9 +270,8 @@ public:
         return;
 
       trie* parent = parent_;
-      parent->children_
-        .erase_and_dispose(*this,
-                           trie_delete_disposer()); // delete this; basically, committing a suicide
+      parent->children_.erase(*this, hash_);
+      delete this; // basically, committing a suicide
     }
   }
 
@@ -294,14 +294,15 @@ public:
     iterator foundNode = (payload_ != PayloadTraits::empty_payload) ? this : 0;
     bool reachLast = true;
 
-    BOOST_FOREACH (const Key& subkey, key) {
-      typename unordered_set::iterator item = trieNode->children_.find(subkey);
-      if (item == trieNode->children_.end()) {
+    for (size_t i = 0; i < key.size(); ++i) {
+      const Key& subkey = key[i];
+      trie* item = trieNode->find_child(subkey, key_component_hash(key, i));
+      if (item == 0) {
         reachLast = false;
         break;
       }
       else {
-        trieNode = &(*item);
+        trieNode = item;
 
         if (trieNode->payload_ != PayloadTraits::empty_payload)
           foundNode = trieNode;
@@ -325,14 +326,15 @@ public:
     iterator foundNode = (payload_ != PayloadTraits::empty_payload) ? this : 0;
     bool reachLast = true;
 
-    BOOST_FOREACH (const Key& subkey, key) {
-      typename unordered_set::iterator item = trieNode->children_.find(subkey);
-      if (item == trieNode->children_.end()) {
+    for (size_t i = 0; i < key.size(); ++i) {
+      const Key& subkey = key[i];
+      trie* item = trieNode->find_child(subkey, key_component_hash(key, i));
+      if (item == 0) {
         reachLast = false;
         break;
       }
       else {
-        trieNode = &(*item);
+        trieNode = item;
 
         if (trieNode->payload_ != PayloadTraits::empty_payload && pred(trieNode->payload_)) {
           foundNode = trieNode;
@@ -355,7 +357,7 @@ public:
       return this;
 
     typedef trie<FullKey, PayloadTraits, PolicyHook> trie;
-    for (typename trie::unordered_set::iterator subnode = children_.begin();
+    for (typename trie::children_type::iterator subnode = children_.begin();
          subnode != children_.end(); subnode++)
     // BOOST_FOREACH (trie &subnode, children_)
     {
@@ -381,7 +383,7 @@ public:
       return this;
 
     typedef trie<FullKey, PayloadTraits, PolicyHook> trie;
-    for (typename trie::unordered_set::iterator subnode = children_.begin();
+    for (typename trie::children_type::iterator subnode = children_.begin();
          subnode != children_.end(); subnode++)
     // BOOST_FOREACH (const trie &subnode, children_)
     {
@@ -407,7 +409,7 @@ public:
   find_if_next_level(Predicate pred)
   {
     typedef trie<FullKey, PayloadTraits, PolicyHook> trie;
-    for (typename trie::unordered_set::iterator subnode = children_.begin();
+    for (typename trie::children_type::iterator subnode = children_.begin();
          subnode != children_.end(); subnode++) {
       if (pred(subnode->key())) {
         return subnode->find();
@@ -453,6 +455,15 @@ public:
     return key_;
   }
 
+  /**
+   * @brief Get parent node, or 0 for the root node
+   */
+  const trie*
+  parent() const
+  {
+    return parent_;
+  }
+
   inline void
   PrintStat(std::ostream& os) const;
 
@@ -466,31 +477,15 @@ private:
     }
   };
 
-  template<class D>
-  struct array_disposer {
-    void
-    operator()(D* array)
-    {
-      delete[] array;
-    }
-  };
-
   friend std::ostream& operator<<<>(std::ostream& os, const trie& trie_node);
 
 public:
   PolicyHook policy_hook_;
 
 private:
-  boost::intrusive::unordered_set_member_hook<> unordered_set_member_hook_;
-
   // necessary typedefs
   typedef trie self_type;
-  typedef boost::intrusive::member_hook<trie, boost::intrusive::unordered_set_member_hook<>,
-                                        &trie::unordered_set_member_hook_> member_hook;
-
-  typedef boost::intrusive::unordered_set<trie, member_hook> unordered_set;
-  typedef typename unordered_set::bucket_type bucket_type;
-  typedef typename unordered_set::bucket_traits bucket_traits;
+  typedef detail::trie_children<trie> children_type;
 
   template<class T, class NonConstT>
   friend class trie_iterator;
@@ -498,19 +493,32 @@ private:
   template<class T>
   friend class trie_point_iterator;
 
+  struct key_equal {
+    bool
+    operator()(const Key& key, const trie& node) const
+    {
+      return key == node.key_;
+    }
+  };
+
+  /**
+   * @brief Find child node by key component, without constructing a temporary trie node
+   * @return the child node, or 0 if there is no such child
+   */
+  inline trie*
+  find_child(const Key& subkey, std::size_t subkeyHash)
+  {
+    return children_.find(subkey, subkeyHash, key_equal());
+  }
+
   ////////////////////////////////////////////////
   // Actual data
   ////////////////////////////////////////////////
 
   Key key_; ///< name component
+  std::size_t hash_; ///< hash of key_, as used to find this node among children of parent_
 
-  size_t initialBucketSize_;
-  size_t bucketIncrement_;
-
-  size_t bucketSize_;
-  typedef boost::interprocess::unique_ptr<bucket_type, array_disposer<bucket_type>> buckets_array;
-  buckets_array buckets_;
-  unordered_set children_;
+  children_type children_;
 
   typename PayloadTraits::storage_type payload_;
   trie* parent_; // to make cleaning effective
@@ -524,7 +532,7 @@ operator<<(std::ostream& os, const trie<FullKey, PayloadTraits, PolicyHook>& tri
      << std::endl;
   typedef trie<FullKey, PayloadTraits, PolicyHook> trie;
 
-  for (typename trie::unordered_set::const_iterator subnode = trie_node.children_.begin();
+  for (typename trie::children_type::const_iterator subnode = trie_node.children_.begin();
        subnode != trie_node.children_.end(); subnode++)
   // BOOST_FOREACH (const trie &subnode, trie_node.children_)
   {
@@ -551,14 +559,12 @@ inline void
 trie<FullKey, PayloadTraits, PolicyHook>::PrintStat(std::ostream& os) const
 {
   os << "# " << key_ << ((payload_ != PayloadTraits::empty_payload) ? "*" : "") << ": "
-     << children_.size() << " children" << std::endl;
-  for (size_t bucket = 0, maxbucket = children_.bucket_count(); bucket < maxbucket; bucket++) {
-    os << " " << children_.bucket_size(bucket);
-  }
-  os << "\n";
+     << children_.size() << " children"
+     << (children_.is_hashed() ? ", hashed" : ", sorted") << " (" << children_.capacity()
+     << " slots)" << std::endl;
 
   typedef trie<FullKey, PayloadTraits, PolicyHook> trie;
-  for (typename trie::unordered_set::const_iterator subnode = children_.begin();
+  for (typename trie::children_type::const_iterator subnode = children_.begin();
        subnode != children_.end(); subnode++)
   // BOOST_FOREACH (const trie &subnode, children_)
   {
@@ -652,17 +658,13 @@ public:
   }
 
 private:
-  typedef typename boost::mpl::if_<boost::is_same<Trie, NonConstTrie>,
-                                   typename Trie::unordered_set::iterator,
-                                   typename Trie::unordered_set::const_iterator>::type set_iterator;
+  typedef typename NonConstTrie::children_type::iterator set_iterator;
 
   Trie*
   goUp()
   {
     if (trie_->parent_ != 0) {
-      // typename Trie::unordered_set::iterator item =
-      set_iterator item = const_cast<NonConstTrie*>(trie_)
-                            ->parent_->children_.iterator_to(const_cast<NonConstTrie&>(*trie_));
+      set_iterator item = trie_->parent_->children_.iterator_to(*trie_, trie_->hash_);
       item++;
       if (item != trie_->parent_->children_.end()) {
         return &(*item);
@@ -683,9 +685,7 @@ private:
 template<class Trie>
 class trie_point_iterator {
 private:
-  typedef typename boost::mpl::if_<boost::is_same<Trie, const Trie>,
-                                   typename Trie::unordered_set::const_iterator,
-                                   typename Trie::unordered_set::iterator>::type set_iterator;
+  typedef typename Trie::children_type::iterator set_iterator;
 
 public:
   trie_point_iterator()
@@ -745,7 +745,7 @@ public:
   operator++(int)
   {
     if (trie_->parent_ != 0) {
-      set_iterator item = trie_->parent_->children_.iterator_to(*trie_);
+      set_iterator item = trie_->parent_->children_.iterator_to(*trie_, trie_->hash_);
       item++;
       if (item == trie_->parent_->children_.end())
         trie_ = 0;